@@ -44,6 +44,8 @@ public class MetaSoundNotify : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "SignalProcessing",
+                "TraceLog",
+                "MetasoundEngine",
             }
             );
         
@@ -1,5 +1,9 @@
 #include "MetaSoundNotify.h"
 #include "MetasoundFrontendRegistries.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyRecorder.h"
+
+DEFINE_LOG_CATEGORY(LogMetaSoundNotify);
 
 #define LOCTEXT_NAMESPACE "FMetaSoundNotifyModule"
 
@@ -7,10 +11,18 @@ void FMetaSoundNotifyModule::StartupModule()
 {
     // Register nodes from the plugin
     FMetasoundFrontendRegistryContainer::Get()->RegisterPendingNodes();
+
+    // Start delivering notifies pushed by the nodes on the game thread
+    FMetaSoundNotifyDispatcher::Get().Startup();
 }
 
 void FMetaSoundNotifyModule::ShutdownModule()
 {
+    // Finish the log before the dispatcher throws away what is left
+    FMetaSoundNotifyReplay::StopConsoleReplay();
+    FMetaSoundNotifyRecorder::Get().Stop();
+
+    FMetaSoundNotifyDispatcher::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
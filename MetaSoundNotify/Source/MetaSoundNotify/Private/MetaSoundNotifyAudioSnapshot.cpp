@@ -0,0 +1,26 @@
+#include "MetaSoundNotifyAudioSnapshot.h"
+#include "DSP/FloatArrayMath.h"
+
+void UMetaSoundNotifyAudioSnapshotLibrary::GetSnapshotSamples(const FMetaSoundNotifyAudioSnapshot& Snapshot, TArray<float>& Samples)
+{
+    Samples = Snapshot.GetSamples();
+}
+
+float UMetaSoundNotifyAudioSnapshotLibrary::GetSnapshotPeak(const FMetaSoundNotifyAudioSnapshot& Snapshot)
+{
+    const TArrayView<const float> Samples = Snapshot.GetSamples();
+    return Samples.Num() > 0 ? Audio::ArrayMaxAbsValue(Samples) : 0.0f;
+}
+
+float UMetaSoundNotifyAudioSnapshotLibrary::GetSnapshotRMS(const FMetaSoundNotifyAudioSnapshot& Snapshot)
+{
+    const TArrayView<const float> Samples = Snapshot.GetSamples();
+    if (Samples.Num() == 0)
+    {
+        return 0.0f;
+    }
+
+    float MeanSquared = 0.0f;
+    Audio::ArrayMeanSquared(Samples, MeanSquared);
+    return FMath::Sqrt(MeanSquared);
+}
@@ -0,0 +1,305 @@
+#include "MetasoundParamHelper.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetaSoundNotifyAudioSnapshot.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyAudioSnapshotNode"
+
+namespace Metasound
+{
+    #pragma region PARAMETERS
+    namespace NotifyAudioSnapshotNode
+    {
+        METASOUND_PARAM(InParamNameAudio, "In", "Audio to publish.")
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
+        METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
+        METASOUND_PARAM(InParamNameWindowSize, "Window Size", "Number of samples of every snapshot, after decimation. Read when the MetaSound starts.")
+        METASOUND_PARAM(InParamNameDecimation, "Decimation", "Only keeps one sample every this many. Read when the MetaSound starts.")
+        METASOUND_PARAM(OutParamNameSent, "On Sent", "Triggered after we send a snapshot.")
+    }
+    #pragma endregion
+
+    #pragma region OPERATOR
+    class FNotifyAudioSnapshotOperator : public TExecutableOperator<FNotifyAudioSnapshotOperator>
+    {
+    public:
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        FNotifyAudioSnapshotOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
+        const FAudioBufferReadRef& InAudioInput,
+        const FStringReadRef& InAddressInput,
+        const FInt32ReadRef& InListenerHandleInput,
+        const FInt32ReadRef& InIDInput,
+        const FInt32ReadRef& InWindowSizeInput,
+        const FInt32ReadRef& InDecimationInput);
+
+        virtual FDataReferenceCollection GetInputs()  const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+
+        void Execute();
+
+    private:
+        FAudioBufferReadRef AudioInput;
+        FStringReadRef AddressInput;
+        FInt32ReadRef ListenerHandleInput;
+        FInt32ReadRef IDInput;
+        FInt32ReadRef WindowSizeInput;
+        FInt32ReadRef DecimationInput;
+
+        FTriggerWriteRef SentTrigger;
+
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+
+        // Enough blocks for listeners to hold on to a few snapshots while the next ones are written.
+        static constexpr int32 NumPoolBlocks = 8;
+
+        // Every block is allocated when the operator is created. A block is free when only the pool references it.
+        TArray<TRefCountPtr<FMetaSoundNotifyAudioBlock>> Pool;
+        FMetaSoundNotifyAudioBlock* CurrentBlock = nullptr;
+        int32 NumWritten = 0;
+        int32 WindowSize = 0;
+        int32 Decimation = 1;
+        // Frame of the next sample to keep, carried over between blocks when decimating.
+        int32 DecimationPhase = 0;
+
+        FMetaSoundNotifyAudioBlock* AcquireBlock();
+        void SendMessageToListener(int32 InFrame);
+    };
+
+    FNotifyAudioSnapshotOperator::FNotifyAudioSnapshotOperator(const FOperatorSettings& InSettings,
+    const FMetasoundEnvironment& InEnvironment,
+    const FAudioBufferReadRef& InAudioInput,
+    const FStringReadRef& InAddressInput,
+    const FInt32ReadRef& InListenerHandleInput,
+    const FInt32ReadRef& InIDInput,
+    const FInt32ReadRef& InWindowSizeInput,
+    const FInt32ReadRef& InDecimationInput)
+    :
+    AudioInput(InAudioInput),
+    AddressInput(InAddressInput),
+    ListenerHandleInput(InListenerHandleInput),
+    IDInput(InIDInput),
+    WindowSizeInput(InWindowSizeInput),
+    DecimationInput(InDecimationInput),
+    SentTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    ListenerCache(InEnvironment),
+    Clock(InSettings)
+    {
+        WindowSize = FMath::Clamp(*WindowSizeInput, 16, 16384);
+        Decimation = FMath::Clamp(*DecimationInput, 1, 64);
+
+        Pool.Reserve(NumPoolBlocks);
+        for (int32 Index = 0; Index < NumPoolBlocks; ++Index)
+        {
+            Pool.Add(new FMetaSoundNotifyAudioBlock(WindowSize));
+        }
+    }
+
+    FDataReferenceCollection FNotifyAudioSnapshotOperator::GetInputs() const
+    {
+        using namespace NotifyAudioSnapshotNode;
+
+        FDataReferenceCollection InputDataReferences;
+
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAudio), AudioInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameWindowSize), WindowSizeInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameDecimation), DecimationInput);
+
+        return InputDataReferences;
+    }
+
+    FDataReferenceCollection FNotifyAudioSnapshotOperator::GetOutputs() const
+    {
+        using namespace NotifyAudioSnapshotNode;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameSent), SentTrigger);
+
+        return OutputDataReferences;
+    }
+
+    void FNotifyAudioSnapshotOperator::Execute()
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
+        SentTrigger->AdvanceBlock();
+
+        const float* Samples = AudioInput->GetData();
+        const int32 NumFrames = AudioInput->Num();
+        int32 Frame = DecimationPhase;
+
+        while (Frame < NumFrames)
+        {
+            if (!CurrentBlock)
+            {
+                CurrentBlock = AcquireBlock();
+                NumWritten = 0;
+            }
+
+            // Every block is still held by a listener, drop the audio until one comes back.
+            if (!CurrentBlock)
+            {
+                Frame += FMath::DivideAndRoundUp(NumFrames - Frame, Decimation) * Decimation;
+                break;
+            }
+
+            float* Window = CurrentBlock->GetData();
+
+            if (Decimation == 1)
+            {
+                const int32 NumToCopy = FMath::Min(NumFrames - Frame, WindowSize - NumWritten);
+                FMemory::Memcpy(&Window[NumWritten], &Samples[Frame], NumToCopy * sizeof(float));
+                NumWritten += NumToCopy;
+                Frame += NumToCopy;
+            }
+            else
+            {
+                while (Frame < NumFrames && NumWritten < WindowSize)
+                {
+                    Window[NumWritten++] = Samples[Frame];
+                    Frame += Decimation;
+                }
+            }
+
+            if (NumWritten == WindowSize)
+            {
+                // Frame already moved past the last sample we kept.
+                const int32 LastFrame = Frame - Decimation;
+
+                CurrentBlock->Publish(NumWritten, Clock.GetSampleRate() / Decimation);
+                SendMessageToListener(LastFrame);
+                SentTrigger->TriggerFrame(LastFrame);
+
+                // The pool keeps it, it becomes free again once every listener let it go.
+                CurrentBlock = nullptr;
+            }
+        }
+
+        DecimationPhase = Frame - NumFrames;
+
+        Clock.AdvanceBlock();
+    }
+
+    FMetaSoundNotifyAudioBlock* FNotifyAudioSnapshotOperator::AcquireBlock()
+    {
+        for (const TRefCountPtr<FMetaSoundNotifyAudioBlock>& Block : Pool)
+        {
+            if (Block.GetRefCount() == 1)
+            {
+                return Block.GetReference();
+            }
+        }
+
+        return nullptr;
+    }
+
+    const FVertexInterface& FNotifyAudioSnapshotOperator::GetVertexInterface()
+    {
+        using namespace NotifyAudioSnapshotNode;
+
+        static const FVertexInterface Interface(
+            FInputVertexInterface(
+                TInputDataVertexModel<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudio)),
+                TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameWindowSize), 512),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameDecimation), 1)
+            ),
+            FOutputVertexInterface(
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameSent))
+            )
+        );
+
+        return Interface;
+    }
+
+    const FNodeClassMetadata& FNotifyAudioSnapshotOperator::GetNodeInfo()
+    {
+        auto InitNodeInfo = []() -> FNodeClassMetadata
+        {
+            FNodeClassMetadata Info;
+
+            Info.ClassName        = { TEXT("UE"), TEXT("NotifyAudioSnapshot"), TEXT("Notify Audio Snapshot") };
+            Info.MajorVersion     = 1;
+            Info.MinorVersion     = 0;
+            Info.DisplayName      = LOCTEXT("Metasound_NotifyAudioSnapshotDisplayName", "Notify Audio Snapshot");
+            Info.Description      = LOCTEXT("Metasound_NotifyAudioSnapshotNodeDescription", "Sends windows of the audio to the listener, to drive visualizers. Snapshots are received through the MetaSounds Notify Event and Batch events.");
+            Info.Author           = PluginAuthor;
+            Info.PromptIfMissing  = PluginNodeMissingPrompt;
+            Info.DefaultInterface = GetVertexInterface();
+            Info.CategoryHierarchy = { LOCTEXT("Metasound_NotifyAudioSnapshotNodeCategory", "Notify") };
+
+            return Info;
+        };
+
+        static const FNodeClassMetadata Info = InitNodeInfo();
+
+        return Info;
+    }
+
+    TUniquePtr<IOperator> FNotifyAudioSnapshotOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace NotifyAudioSnapshotNode;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudio), InParams.OperatorSettings);
+        FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
+        FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
+        FInt32ReadRef WindowSizeIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameWindowSize), InParams.OperatorSettings);
+        FInt32ReadRef DecimationIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameDecimation), InParams.OperatorSettings);
+
+        return MakeUnique<FNotifyAudioSnapshotOperator>(InParams.OperatorSettings, InParams.Environment, AudioIn, AddressIn, ListenerHandleIn, IDIn, WindowSizeIn, DecimationIn);
+    }
+
+    void FNotifyAudioSnapshotOperator::SendMessageToListener(int32 InFrame){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
+
+        FMetaSoundNotifyRecord Record;
+
+        if (ListenerCache.Resolve(*AddressInput, *ListenerHandleInput, Record.Listener))
+        {
+            Record.Type = EMetaSoundNotifyType::AudioSnapshot;
+            Record.NotifyID = *IDInput;
+            // Only a reference goes through the queue, the samples stay in the block.
+            Record.AudioBlock = CurrentBlock;
+
+            Clock.Stamp(InFrame, Record);
+
+            FMetaSoundNotifyDispatcher::Get().Enqueue(Record);
+        }
+    }
+    #pragma endregion
+
+    #pragma region NODE
+    class FNotifyAudioSnapshotNode : public FNodeFacade
+    {
+    public:
+        FNotifyAudioSnapshotNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FNotifyAudioSnapshotOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FNotifyAudioSnapshotNode)
+    #pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
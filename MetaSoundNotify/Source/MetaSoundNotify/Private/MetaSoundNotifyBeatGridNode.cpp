@@ -0,0 +1,301 @@
+#include "MetasoundParamHelper.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundPrimitives.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyBeatGridNode"
+
+namespace Metasound
+{
+    #pragma region PARAMETERS
+    namespace NotifyBeatGridNode
+    {
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
+        METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
+        METASOUND_PARAM(InParamNamePlayback, "Playback Time", "Current playback time of the music, in seconds.")
+        METASOUND_PARAM(InParamNameBPM, "BPM", "Tempo of the music, in quarter notes per minute.")
+        METASOUND_PARAM(InParamNameBeatsPerBar, "Beats Per Bar", "Upper number of the time signature.")
+        METASOUND_PARAM(InParamNameBeatUnit, "Beat Unit", "Lower number of the time signature (4 for quarter notes, 8 for eighth notes...).")
+        METASOUND_PARAM(InParamNameOffset, "Offset", "Time of the first beat of the first bar, in seconds.")
+        METASOUND_PARAM(OutParamNameBeat, "On Beat", "Triggered on the exact frame of every beat.")
+        METASOUND_PARAM(OutParamNameBar, "On Bar", "Triggered on the exact frame of the first beat of every bar.")
+    }
+    #pragma endregion
+
+    #pragma region OPERATOR
+    class FNotifyBeatGridOperator : public TExecutableOperator<FNotifyBeatGridOperator>
+    {
+    public:
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        FNotifyBeatGridOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
+        const FStringReadRef& InAddressInput,
+        const FInt32ReadRef& InListenerHandleInput,
+        const FInt32ReadRef& InIDInput,
+        const FFloatReadRef& InPlaybackInput,
+        const FFloatReadRef& InBPMInput,
+        const FInt32ReadRef& InBeatsPerBarInput,
+        const FInt32ReadRef& InBeatUnitInput,
+        const FFloatReadRef& InOffsetInput);
+
+        virtual FDataReferenceCollection GetInputs()  const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+
+        void Execute();
+
+    private:
+        FStringReadRef AddressInput;
+        FInt32ReadRef ListenerHandleInput;
+        FInt32ReadRef IDInput;
+        FFloatReadRef PlaybackInput;
+        FFloatReadRef BPMInput;
+        FInt32ReadRef BeatsPerBarInput;
+        FInt32ReadRef BeatUnitInput;
+        FFloatReadRef OffsetInput;
+
+        FTriggerWriteRef BeatTrigger;
+        FTriggerWriteRef BarTrigger;
+
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+
+        // Beat position (in beats since the offset) at the end of the previous block.
+        bool bHasLastBeatPosition = false;
+        double LastBeatPosition = 0.0;
+        // How many beats the playback moved during the last block it moved forward.
+        double BeatStep = 0.0;
+
+        // More beats than this in a single block is a seek, not music.
+        static constexpr int32 MaxBeatsPerBlock = 16;
+
+        void SendMessageToListener(int32 InFrame, int64 InBeatIndex, int32 InBeatsPerBar);
+    };
+
+    FNotifyBeatGridOperator::FNotifyBeatGridOperator(const FOperatorSettings& InSettings,
+    const FMetasoundEnvironment& InEnvironment,
+    const FStringReadRef& InAddressInput,
+    const FInt32ReadRef& InListenerHandleInput,
+    const FInt32ReadRef& InIDInput,
+    const FFloatReadRef& InPlaybackInput,
+    const FFloatReadRef& InBPMInput,
+    const FInt32ReadRef& InBeatsPerBarInput,
+    const FInt32ReadRef& InBeatUnitInput,
+    const FFloatReadRef& InOffsetInput)
+    :
+    AddressInput(InAddressInput),
+    ListenerHandleInput(InListenerHandleInput),
+    IDInput(InIDInput),
+    PlaybackInput(InPlaybackInput),
+    BPMInput(InBPMInput),
+    BeatsPerBarInput(InBeatsPerBarInput),
+    BeatUnitInput(InBeatUnitInput),
+    OffsetInput(InOffsetInput),
+    BeatTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    BarTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    ListenerCache(InEnvironment),
+    Clock(InSettings)
+    {
+    }
+
+    FDataReferenceCollection FNotifyBeatGridOperator::GetInputs() const
+    {
+        using namespace NotifyBeatGridNode;
+
+        FDataReferenceCollection InputDataReferences;
+
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNamePlayback), PlaybackInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameBPM), BPMInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameBeatsPerBar), BeatsPerBarInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameBeatUnit), BeatUnitInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameOffset), OffsetInput);
+
+        return InputDataReferences;
+    }
+
+    FDataReferenceCollection FNotifyBeatGridOperator::GetOutputs() const
+    {
+        using namespace NotifyBeatGridNode;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameBeat), BeatTrigger);
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameBar), BarTrigger);
+
+        return OutputDataReferences;
+    }
+
+    void FNotifyBeatGridOperator::Execute()
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
+        BeatTrigger->AdvanceBlock();
+        BarTrigger->AdvanceBlock();
+
+        const int32 BeatsPerBar = FMath::Max(*BeatsPerBarInput, 1);
+        const double BeatsPerSecond = FMath::Max(*BPMInput, 0.0f) / 60.0 * FMath::Max(*BeatUnitInput, 1) / 4.0;
+
+        // Everything below is a handful of arithmetic operations per block, whatever the block size.
+        const double BeatPosition = (static_cast<double>(*PlaybackInput) - *OffsetInput) * BeatsPerSecond;
+        // On the first block, a beat exactly at the current position still counts as crossed.
+        double StartPosition = bHasLastBeatPosition ? LastBeatPosition : BeatPosition - KINDA_SMALL_NUMBER;
+
+        if (bHasLastBeatPosition && BeatPosition < LastBeatPosition)
+        {
+            // The playback jumped back (loop or seek). Like the cue point nodes, our best guess of where this block
+            // started is one step before the current position, with a bit of slack so the downbeat right at the loop
+            // start isn't missed.
+            StartPosition = BeatPosition - BeatStep - KINDA_SMALL_NUMBER;
+        }
+        else if (bHasLastBeatPosition && BeatPosition > LastBeatPosition)
+        {
+            BeatStep = BeatPosition - LastBeatPosition;
+        }
+
+        // Beats crossed during this block are the integers in (StartPosition, BeatPosition].
+        const int64 FirstBeat = FMath::Max<int64>(FMath::FloorToInt64(StartPosition) + 1, 0);
+        const int64 LastBeat = FMath::FloorToInt64(BeatPosition);
+        const int64 NumBeats = LastBeat - FirstBeat + 1;
+
+        // Jumping far ahead (a seek) just moves the grid without sending anything.
+        if (NumBeats > 0 && NumBeats <= MaxBeatsPerBlock && BeatPosition > StartPosition)
+        {
+            const int32 NumFrames = Clock.GetNumFramesPerBlock();
+            const double Distance = BeatPosition - StartPosition;
+            const bool bCanSend = ListenerCache.CanResolve(*AddressInput, *ListenerHandleInput);
+
+            for (int64 BeatIndex = FirstBeat; BeatIndex <= LastBeat; ++BeatIndex)
+            {
+                const int32 Frame = FMath::Clamp(static_cast<int32>((BeatIndex - StartPosition) / Distance * NumFrames), 0, NumFrames - 1);
+
+                BeatTrigger->TriggerFrame(Frame);
+                if (BeatIndex % BeatsPerBar == 0)
+                {
+                    BarTrigger->TriggerFrame(Frame);
+                }
+
+                if (bCanSend)
+                {
+                    SendMessageToListener(Frame, BeatIndex, BeatsPerBar);
+                }
+            }
+        }
+
+        LastBeatPosition = BeatPosition;
+        bHasLastBeatPosition = true;
+
+        Clock.AdvanceBlock();
+    }
+
+    const FVertexInterface& FNotifyBeatGridOperator::GetVertexInterface()
+    {
+        using namespace NotifyBeatGridNode;
+
+        static const FVertexInterface Interface(
+            FInputVertexInterface(
+                TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID)),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePlayback)),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameBPM), 120.0f),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameBeatsPerBar), 4),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameBeatUnit), 4),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameOffset))
+            ),
+
+            FOutputVertexInterface(
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameBeat)),
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameBar))
+            )
+        );
+
+        return Interface;
+    }
+
+    const FNodeClassMetadata& FNotifyBeatGridOperator::GetNodeInfo()
+    {
+        auto InitNodeInfo = []() -> FNodeClassMetadata
+        {
+            FNodeClassMetadata Info;
+
+            Info.ClassName        = { TEXT("UE"), TEXT("NotifyBeatGrid"), TEXT("Notify Beat Grid") };
+            Info.MajorVersion     = 1;
+            Info.MinorVersion     = 0;
+            Info.DisplayName      = LOCTEXT("Metasound_NotifyBeatGridDisplayName", "Notify Beat Grid");
+            Info.Description      = LOCTEXT("Metasound_NotifyBeatGridNodeDescription", "Computes the beat and bar grid of the music from its tempo and time signature, and sends a beat notify (bar and beat indices) on the exact frame of every beat. Beat notifies are received through the MetaSounds Notify Event and Batch events.");
+            Info.Author           = PluginAuthor;
+            Info.PromptIfMissing  = PluginNodeMissingPrompt;
+            Info.DefaultInterface = GetVertexInterface();
+            Info.CategoryHierarchy = { LOCTEXT("Metasound_NotifyBeatGridNodeCategory", "Notify") };
+
+            return Info;
+        };
+
+        static const FNodeClassMetadata Info = InitNodeInfo();
+
+        return Info;
+    }
+
+    TUniquePtr<IOperator> FNotifyBeatGridOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace NotifyBeatGridNode;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
+        FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
+        FFloatReadRef PlaybackIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNamePlayback), InParams.OperatorSettings);
+        FFloatReadRef BPMIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameBPM), InParams.OperatorSettings);
+        FInt32ReadRef BeatsPerBarIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameBeatsPerBar), InParams.OperatorSettings);
+        FInt32ReadRef BeatUnitIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameBeatUnit), InParams.OperatorSettings);
+        FFloatReadRef OffsetIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameOffset), InParams.OperatorSettings);
+
+        return MakeUnique<FNotifyBeatGridOperator>(InParams.OperatorSettings, InParams.Environment, AddressIn, ListenerHandleIn, IDIn, PlaybackIn, BPMIn, BeatsPerBarIn, BeatUnitIn, OffsetIn);
+    }
+
+    void FNotifyBeatGridOperator::SendMessageToListener(int32 InFrame, int64 InBeatIndex, int32 InBeatsPerBar){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
+
+        FMetaSoundNotifyRecord Record;
+
+        if (ListenerCache.Resolve(*AddressInput, *ListenerHandleInput, Record.Listener))
+        {
+            Record.Type = EMetaSoundNotifyType::Beat;
+            Record.NotifyID = *IDInput;
+            Record.Bar = static_cast<int32>(InBeatIndex / InBeatsPerBar);
+            Record.Beat = static_cast<int32>(InBeatIndex % InBeatsPerBar);
+            Record.bBoolValue = Record.Beat == 0;
+
+            Clock.Stamp(InFrame, Record);
+
+            FMetaSoundNotifyDispatcher::Get().Enqueue(Record);
+        }
+    }
+    #pragma endregion
+
+    #pragma region NODE
+    class FNotifyBeatGridNode : public FNodeFacade
+    {
+    public:
+        FNotifyBeatGridNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FNotifyBeatGridOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FNotifyBeatGridNode)
+    #pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,532 @@
+#include "MetaSoundNotifyBenchmarkCommandlet.h"
+#include "MetaSoundNotify.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyInterface.h"
+#include "MetaSoundNotifyMockListener.h"
+#include "MetaSoundNotifySubsystem.h"
+#include "MetaSoundNotifyOperatorHarness.h"
+#include "Async/Async.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace MetaSoundNotifyBenchmark
+{
+    struct FDeliveryResult
+    {
+        int64 NumEvents = 0;
+        double Seconds = 0.0;
+
+        double GetNanosecondsPerEvent() const
+        {
+            return NumEvents > 0 ? Seconds * 1e9 / NumEvents : 0.0;
+        }
+    };
+
+    // Pushes EventsPerFrame float notifies for Listener every frame and times the drains that deliver them.
+    FDeliveryResult MeasureDelivery(UObject* Listener, int32 EventsPerFrame, int32 NumFrames)
+    {
+        FMetaSoundNotifyDispatcher& Dispatcher = FMetaSoundNotifyDispatcher::Get();
+
+        FMetaSoundNotifyRecord Record;
+        Record.Listener.Object = Listener;
+        Record.Type = EMetaSoundNotifyType::Float;
+        Record.SampleRate = 48000.0f;
+
+        FDeliveryResult Result;
+        uint64 Cycles = 0;
+
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 EventIndex = 0; EventIndex < EventsPerFrame; ++EventIndex)
+            {
+                Record.NotifyID = EventIndex & 3;
+                Record.FloatValue = static_cast<float>(EventIndex);
+                Record.SampleIndex += 1;
+                Dispatcher.Enqueue(Record);
+            }
+
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Dispatcher.Drain();
+            Cycles += FPlatformTime::Cycles64() - StartCycles;
+
+            Result.NumEvents += EventsPerFrame;
+        }
+
+        Result.Seconds = FPlatformTime::ToSeconds64(Cycles);
+        return Result;
+    }
+
+    void LogDelivery(const TCHAR* Name, const FDeliveryResult& Result)
+    {
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("%-10s %10lld events %10.3f ms %10.1f ns/event"), Name, Result.NumEvents, Result.Seconds * 1000.0, Result.GetNanosecondsPerEvent());
+    }
+
+    double GetPercentile(const TArray<double>& SortedValues, double Percentile)
+    {
+        if (SortedValues.Num() == 0)
+        {
+            return 0.0;
+        }
+
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+        return SortedValues[Index];
+    }
+
+    // Notify Float node, the one the latency and scale benchmarks drive. Names must match the registered class names.
+    const Metasound::FNodeClassName NotifyFloatClassName = { TEXT("UE"), TEXT("NotifyFloat"), TEXT("NotifyFloat") };
+    constexpr int32 NotifyFloatMajorVersion = 1;
+    constexpr int32 NotifyFloatMinorVersion = 2;
+
+    const Metasound::FNodeClassName NotifyRawCuePointClassName = { TEXT("UE"), TEXT("NotifyRawCuePoint"), TEXT("Notify Raw Cue Point") };
+    constexpr int32 NotifyRawCuePointMajorVersion = 1;
+    constexpr int32 NotifyRawCuePointMinorVersion = 2;
+
+    /**
+     * Executes every instance for NumBlocks blocks and returns the average Execute() time per block per instance, in ns.
+     * Prepare sets the inputs of an instance before each block, outside of the measure. Instances run in chunks that
+     * fit in the notify queue, drained between chunks, so firing blocks never drop notifies.
+     */
+    double MeasureExecute(TArray<TUniquePtr<FMetaSoundNotifyOperatorHarness>>& Instances, int32 NumBlocks, TFunctionRef<void(int32, int32)> Prepare)
+    {
+        FMetaSoundNotifyDispatcher& Dispatcher = FMetaSoundNotifyDispatcher::Get();
+        const int32 ChunkSize = FMetaSoundNotifyDispatcher::QueueCapacity / 2;
+        uint64 Cycles = 0;
+
+        for (int32 Block = 0; Block < NumBlocks; ++Block)
+        {
+            for (int32 ChunkStart = 0; ChunkStart < Instances.Num(); ChunkStart += ChunkSize)
+            {
+                const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, Instances.Num());
+
+                for (int32 InstanceIndex = ChunkStart; InstanceIndex < ChunkEnd; ++InstanceIndex)
+                {
+                    Prepare(InstanceIndex, Block);
+                }
+
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                for (int32 InstanceIndex = ChunkStart; InstanceIndex < ChunkEnd; ++InstanceIndex)
+                {
+                    Instances[InstanceIndex]->Execute();
+                }
+                Cycles += FPlatformTime::Cycles64() - StartCycles;
+
+                Dispatcher.Drain();
+            }
+        }
+
+        const int64 NumExecutes = static_cast<int64>(NumBlocks) * Instances.Num();
+        return NumExecutes > 0 ? FPlatformTime::ToSeconds64(Cycles) * 1e9 / NumExecutes : 0.0;
+    }
+}
+
+UMetaSoundNotifyBenchmarkCommandlet::UMetaSoundNotifyBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UMetaSoundNotifyBenchmarkCommandlet::Main(const FString& Params)
+{
+    FString Mode = TEXT("Delivery");
+    FParse::Value(*Params, TEXT("Mode="), Mode);
+
+    if (Mode == TEXT("Delivery"))
+    {
+        return RunDelivery(Params);
+    }
+    else if (Mode == TEXT("Latency"))
+    {
+        return RunLatency(Params);
+    }
+    else if (Mode == TEXT("Scale"))
+    {
+        return RunScale(Params);
+    }
+
+    UE_LOG(LogMetaSoundNotify, Error, TEXT("Unknown benchmark mode %s. Usage: -run=MetaSoundNotifyBenchmark -Mode=<Delivery|Latency|Scale>"), *Mode);
+    return 1;
+}
+
+int32 UMetaSoundNotifyBenchmarkCommandlet::RunDelivery(const FString& Params)
+{
+    using namespace MetaSoundNotifyBenchmark;
+
+    int32 Rate = 10000;
+    float Seconds = 10.0f;
+    int32 FrameRate = 60;
+    FString ListenerClassPath;
+
+    FParse::Value(*Params, TEXT("Rate="), Rate);
+    FParse::Value(*Params, TEXT("Seconds="), Seconds);
+    FParse::Value(*Params, TEXT("FrameRate="), FrameRate);
+    FParse::Value(*Params, TEXT("ListenerClass="), ListenerClassPath);
+
+    UMetaSoundNotifySubsystem* Subsystem = UMetaSoundNotifySubsystem::Get();
+    if (!Subsystem)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("The MetaSound Notify subsystem isn't available."));
+        return 1;
+    }
+
+    FrameRate = FMath::Max(FrameRate, 1);
+    const int32 NumFrames = FMath::Max(FMath::RoundToInt(Seconds * FrameRate), 1);
+    // Everything pushed in a frame has to fit in the queue, the benchmark doesn't measure drops.
+    const int32 EventsPerFrame = FMath::Clamp(Rate / FrameRate, 1, static_cast<int32>(FMetaSoundNotifyDispatcher::QueueCapacity));
+
+    UE_LOG(LogMetaSoundNotify, Display, TEXT("Delivery benchmark: %d events per frame, %d frames (%d events/s at %d fps)."), EventsPerFrame, NumFrames, EventsPerFrame * FrameRate, FrameRate);
+
+    // Warm up the class cache and the scratch arrays before measuring anything.
+    UMetaSoundNotifyMockListener* NativeListener = NewObject<UMetaSoundNotifyMockListener>();
+    NativeListener->AddToRoot();
+    Subsystem->AddNativeListener(NativeListener, INDEX_NONE, FMetaSoundNotifyNativeDelegate::CreateUObject(NativeListener, &UMetaSoundNotifyMockListener::OnNotify));
+
+    MeasureDelivery(NativeListener, EventsPerFrame, 1);
+    NativeListener->NumReceived = 0;
+
+    const FDeliveryResult NativeResult = MeasureDelivery(NativeListener, EventsPerFrame, NumFrames);
+    LogDelivery(TEXT("Native"), NativeResult);
+
+    if (NativeListener->NumReceived != NativeResult.NumEvents)
+    {
+        UE_LOG(LogMetaSoundNotify, Warning, TEXT("The native listener received %lld of %lld events."), NativeListener->NumReceived, NativeResult.NumEvents);
+    }
+
+    Subsystem->RemoveNativeListeners(NativeListener);
+    NativeListener->RemoveFromRoot();
+
+    if (ListenerClassPath.IsEmpty())
+    {
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Pass -ListenerClass=<Blueprint class implementing the MetaSound Notify interface> to compare with the interface."));
+        return 0;
+    }
+
+    UClass* ListenerClass = FSoftClassPath(ListenerClassPath).TryLoadClass<UObject>();
+    if (!ListenerClass || !ListenerClass->ImplementsInterface(UMetaSoundNotifyInterface::StaticClass()))
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("%s isn't a class implementing the MetaSound Notify interface."), *ListenerClassPath);
+        return 1;
+    }
+
+    UObject* InterfaceListener = NewObject<UObject>(GetTransientPackage(), ListenerClass);
+    InterfaceListener->AddToRoot();
+
+    MeasureDelivery(InterfaceListener, EventsPerFrame, 1);
+
+    const FDeliveryResult InterfaceResult = MeasureDelivery(InterfaceListener, EventsPerFrame, NumFrames);
+    LogDelivery(TEXT("Interface"), InterfaceResult);
+
+    InterfaceListener->RemoveFromRoot();
+
+    if (NativeResult.GetNanosecondsPerEvent() > 0.0)
+    {
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Native delivery saves %.1f ns per event (%.2fx)."),
+            InterfaceResult.GetNanosecondsPerEvent() - NativeResult.GetNanosecondsPerEvent(),
+            InterfaceResult.GetNanosecondsPerEvent() / NativeResult.GetNanosecondsPerEvent());
+    }
+
+    return 0;
+}
+
+int32 UMetaSoundNotifyBenchmarkCommandlet::RunLatency(const FString& Params)
+{
+    using namespace MetaSoundNotifyBenchmark;
+
+    int32 NumInstances = 64;
+    int32 SendEvery = 4;
+    float Seconds = 10.0f;
+    int32 FrameRate = 60;
+    float SampleRate = 48000.0f;
+    int32 BlockSize = 256;
+
+    FParse::Value(*Params, TEXT("Instances="), NumInstances);
+    FParse::Value(*Params, TEXT("SendEvery="), SendEvery);
+    FParse::Value(*Params, TEXT("Seconds="), Seconds);
+    FParse::Value(*Params, TEXT("FrameRate="), FrameRate);
+    FParse::Value(*Params, TEXT("SampleRate="), SampleRate);
+    FParse::Value(*Params, TEXT("BlockSize="), BlockSize);
+
+    NumInstances = FMath::Max(NumInstances, 1);
+    SendEvery = FMath::Max(SendEvery, 1);
+    FrameRate = FMath::Max(FrameRate, 1);
+    BlockSize = FMath::Max(BlockSize, 16);
+
+    UMetaSoundNotifySubsystem* Subsystem = UMetaSoundNotifySubsystem::Get();
+    if (!Subsystem)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("The MetaSound Notify subsystem isn't available."));
+        return 1;
+    }
+
+    // Cycle count at the start of every block rendered, so the listener can tell how long ago its notify was sent.
+    // Notifies are sent on the first frame of their block, the block is found back from the sample index of the event.
+    constexpr int32 NumBlockTimes = 1 << 16;
+    TUniquePtr<std::atomic<uint64>[]> BlockCycles = MakeUnique<std::atomic<uint64>[]>(NumBlockTimes);
+
+    const double DurationSeconds = FMath::Max(Seconds, 0.1f);
+    const int64 ExpectedEvents = static_cast<int64>(DurationSeconds * SampleRate / BlockSize / SendEvery + 1.0) * NumInstances;
+
+    TArray<double> Latencies;
+    Latencies.Reserve(ExpectedEvents);
+
+    UMetaSoundNotifyMockListener* Listener = NewObject<UMetaSoundNotifyMockListener>();
+    Listener->AddToRoot();
+
+    const int32 Handle = Subsystem->RegisterListener(Listener);
+    Subsystem->AddNativeListener(Listener, INDEX_NONE, FMetaSoundNotifyNativeDelegate::CreateLambda([&BlockCycles, &Latencies, BlockSize](const FMetaSoundNotifyEvent& Event)
+    {
+        const uint64 SendCycles = BlockCycles[(Event.SampleIndex / BlockSize) & (NumBlockTimes - 1)].load(std::memory_order_relaxed);
+        Latencies.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SendCycles));
+    }));
+
+    const Metasound::FOperatorSettings Settings(SampleRate, SampleRate / BlockSize);
+
+    TArray<TUniquePtr<FMetaSoundNotifyOperatorHarness>> Instances;
+    TArray<Metasound::FTriggerWriteRef> SendTriggers;
+
+    int32 Result = 0;
+
+    for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+    {
+        TUniquePtr<FMetaSoundNotifyOperatorHarness> Instance = MakeUnique<FMetaSoundNotifyOperatorHarness>(Settings);
+        if (!Instance->CreateNode(NotifyFloatClassName, NotifyFloatMajorVersion, NotifyFloatMinorVersion))
+        {
+            Result = 1;
+            break;
+        }
+
+        SendTriggers.Add(Instance->AddTrigger(TEXT("Send")));
+        Instance->AddInput<int32>(TEXT("Listener Handle"), Handle);
+        Instance->AddInput<int32>(TEXT("Notify ID"), InstanceIndex);
+        Instance->AddInput<float>(TEXT("Value"), static_cast<float>(InstanceIndex));
+
+        if (!Instance->CreateOperator())
+        {
+            Result = 1;
+            break;
+        }
+
+        Instances.Add(MoveTemp(Instance));
+    }
+
+    if (Result == 0)
+    {
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Latency benchmark: %d Notify Float operators sending every %d blocks of %d samples at %.0f Hz, drained at %d fps, for %.1f s."),
+            NumInstances, SendEvery, BlockSize, SampleRate, FrameRate, DurationSeconds);
+
+        std::atomic<bool> bStopRendering{ false };
+        std::atomic<int64> NumSent{ 0 };
+
+        // Render thread, paced like a real audio device would.
+        TFuture<void> Rendering = Async(EAsyncExecution::Thread, [&]()
+        {
+            const double BlockSeconds = BlockSize / SampleRate;
+            const double StartSeconds = FPlatformTime::Seconds();
+
+            for (int64 Block = 0; !bStopRendering.load(std::memory_order_relaxed); ++Block)
+            {
+                const bool bSend = (Block % SendEvery) == 0;
+                if (bSend)
+                {
+                    for (Metasound::FTriggerWriteRef& Trigger : SendTriggers)
+                    {
+                        Trigger->TriggerFrame(0);
+                    }
+                }
+
+                BlockCycles[Block & (NumBlockTimes - 1)].store(FPlatformTime::Cycles64(), std::memory_order_relaxed);
+
+                for (TUniquePtr<FMetaSoundNotifyOperatorHarness>& Instance : Instances)
+                {
+                    Instance->Execute();
+                }
+
+                if (bSend)
+                {
+                    NumSent.fetch_add(NumInstances, std::memory_order_relaxed);
+                }
+
+                const double SleepSeconds = StartSeconds + (Block + 1) * BlockSeconds - FPlatformTime::Seconds();
+                if (SleepSeconds > 0.0)
+                {
+                    FPlatformProcess::Sleep(static_cast<float>(SleepSeconds));
+                }
+            }
+        });
+
+        // Game thread, draining once per frame like the core ticker does.
+        FMetaSoundNotifyDispatcher& Dispatcher = FMetaSoundNotifyDispatcher::Get();
+        const double FrameSeconds = 1.0 / FrameRate;
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        for (int64 Frame = 0; FPlatformTime::Seconds() - StartSeconds < DurationSeconds; ++Frame)
+        {
+            Dispatcher.Drain();
+
+            const double SleepSeconds = StartSeconds + (Frame + 1) * FrameSeconds - FPlatformTime::Seconds();
+            if (SleepSeconds > 0.0)
+            {
+                FPlatformProcess::Sleep(static_cast<float>(SleepSeconds));
+            }
+        }
+
+        bStopRendering.store(true, std::memory_order_relaxed);
+        Rendering.Wait();
+        Dispatcher.Drain();
+
+        const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+        Latencies.Sort();
+
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Sent %lld, delivered %d notifies, %.0f events/s."), NumSent.load(), Latencies.Num(), Latencies.Num() / ElapsedSeconds);
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Latency p50 %.3f ms, p99 %.3f ms, max %.3f ms."), GetPercentile(Latencies, 0.5), GetPercentile(Latencies, 0.99), Latencies.Num() > 0 ? Latencies.Last() : 0.0);
+
+        Result = Latencies.Num() == NumSent.load() ? 0 : 1;
+    }
+
+    // The binding captures locals of this function, it must not outlive it.
+    Subsystem->RemoveNativeListeners(Listener);
+    Subsystem->UnregisterListener(Handle);
+    Listener->RemoveFromRoot();
+
+    return Result;
+}
+
+int32 UMetaSoundNotifyBenchmarkCommandlet::RunScale(const FString& Params)
+{
+    using namespace MetaSoundNotifyBenchmark;
+
+    int32 NumOperators = 10000;
+    int32 NumBlocks = 200;
+    float SampleRate = 48000.0f;
+    int32 BlockSize = 256;
+
+    FParse::Value(*Params, TEXT("Operators="), NumOperators);
+    FParse::Value(*Params, TEXT("Blocks="), NumBlocks);
+    FParse::Value(*Params, TEXT("SampleRate="), SampleRate);
+    FParse::Value(*Params, TEXT("BlockSize="), BlockSize);
+
+    NumOperators = FMath::Max(NumOperators, 1);
+    NumBlocks = FMath::Max(NumBlocks, 1);
+    BlockSize = FMath::Max(BlockSize, 16);
+
+    UMetaSoundNotifySubsystem* Subsystem = UMetaSoundNotifySubsystem::Get();
+    if (!Subsystem)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("The MetaSound Notify subsystem isn't available."));
+        return 1;
+    }
+
+    UMetaSoundNotifyMockListener* Listener = NewObject<UMetaSoundNotifyMockListener>();
+    Listener->AddToRoot();
+
+    const int32 Handle = Subsystem->RegisterListener(Listener);
+    Subsystem->AddNativeListener(Listener, INDEX_NONE, FMetaSoundNotifyNativeDelegate::CreateUObject(Listener, &UMetaSoundNotifyMockListener::OnNotify));
+
+    const Metasound::FOperatorSettings Settings(SampleRate, SampleRate / BlockSize);
+    const float BlockSeconds = BlockSize / SampleRate;
+
+    UE_LOG(LogMetaSoundNotify, Display, TEXT("Scale benchmark: %d operators, %d blocks of %d samples."), NumOperators, NumBlocks, BlockSize);
+
+    int32 Result = 0;
+
+    // Notify Float: idle without Send, firing with Send triggered on every block.
+    {
+        TArray<TUniquePtr<FMetaSoundNotifyOperatorHarness>> Instances;
+        TArray<Metasound::FTriggerWriteRef> SendTriggers;
+
+        for (int32 InstanceIndex = 0; InstanceIndex < NumOperators; ++InstanceIndex)
+        {
+            TUniquePtr<FMetaSoundNotifyOperatorHarness> Instance = MakeUnique<FMetaSoundNotifyOperatorHarness>(Settings);
+            if (!Instance->CreateNode(NotifyFloatClassName, NotifyFloatMajorVersion, NotifyFloatMinorVersion))
+            {
+                Result = 1;
+                break;
+            }
+
+            SendTriggers.Add(Instance->AddTrigger(TEXT("Send")));
+            Instance->AddInput<int32>(TEXT("Listener Handle"), Handle);
+            Instance->AddInput<int32>(TEXT("Notify ID"), InstanceIndex);
+            Instance->AddInput<float>(TEXT("Value"), 1.0f);
+
+            if (!Instance->CreateOperator())
+            {
+                Result = 1;
+                break;
+            }
+
+            Instances.Add(MoveTemp(Instance));
+        }
+
+        if (Result == 0)
+        {
+            const double IdleNs = MeasureExecute(Instances, NumBlocks, [](int32, int32) {});
+            const double FiringNs = MeasureExecute(Instances, NumBlocks, [&SendTriggers](int32 InstanceIndex, int32)
+            {
+                SendTriggers[InstanceIndex]->TriggerFrame(0);
+            });
+
+            UE_LOG(LogMetaSoundNotify, Display, TEXT("%-20s idle %8.1f ns/block  firing %8.1f ns/block"), TEXT("Notify Float"), IdleNs, FiringNs);
+        }
+    }
+
+    // Notify Raw Cue Point: idle while listening for a cue point far ahead, firing when re-armed past the cue point on
+    // every block.
+    if (Result == 0)
+    {
+        TArray<TUniquePtr<FMetaSoundNotifyOperatorHarness>> Instances;
+        TArray<Metasound::FTriggerWriteRef> ListenTriggers;
+        TArray<Metasound::FFloatWriteRef> PlaybackInputs;
+        TArray<Metasound::FFloatWriteRef> CuePointInputs;
+
+        for (int32 InstanceIndex = 0; InstanceIndex < NumOperators; ++InstanceIndex)
+        {
+            TUniquePtr<FMetaSoundNotifyOperatorHarness> Instance = MakeUnique<FMetaSoundNotifyOperatorHarness>(Settings);
+            if (!Instance->CreateNode(NotifyRawCuePointClassName, NotifyRawCuePointMajorVersion, NotifyRawCuePointMinorVersion))
+            {
+                Result = 1;
+                break;
+            }
+
+            ListenTriggers.Add(Instance->AddTrigger(TEXT("Listen")));
+            Instance->AddInput<int32>(TEXT("Listener Handle"), Handle);
+            Instance->AddInput<int32>(TEXT("Notify ID"), InstanceIndex);
+            Instance->AddInput<FString>(TEXT("Message"), TEXT("Cue"));
+            PlaybackInputs.Add(Instance->AddInput<float>(TEXT("Playback Position"), 0.0f));
+            CuePointInputs.Add(Instance->AddInput<float>(TEXT("Cue Point Position"), TNumericLimits<float>::Max()));
+            Instance->AddInput<bool>(TEXT("Start Listening"), true);
+
+            if (!Instance->CreateOperator())
+            {
+                Result = 1;
+                break;
+            }
+
+            Instances.Add(MoveTemp(Instance));
+        }
+
+        if (Result == 0)
+        {
+            const double IdleNs = MeasureExecute(Instances, NumBlocks, [&PlaybackInputs, BlockSeconds](int32 InstanceIndex, int32 Block)
+            {
+                *PlaybackInputs[InstanceIndex] = (Block + 1) * BlockSeconds;
+            });
+            const double FiringNs = MeasureExecute(Instances, NumBlocks, [&](int32 InstanceIndex, int32 Block)
+            {
+                *PlaybackInputs[InstanceIndex] = (NumBlocks + Block + 1) * BlockSeconds;
+                *CuePointInputs[InstanceIndex] = 0.0f;
+                ListenTriggers[InstanceIndex]->TriggerFrame(0);
+            });
+
+            UE_LOG(LogMetaSoundNotify, Display, TEXT("%-20s idle %8.1f ns/block  firing %8.1f ns/block"), TEXT("Notify Raw Cue Point"), IdleNs, FiringNs);
+        }
+    }
+
+    UE_LOG(LogMetaSoundNotify, Display, TEXT("Delivered %lld notifies."), Listener->NumReceived);
+
+    Subsystem->RemoveNativeListeners(Listener);
+    Subsystem->UnregisterListener(Handle);
+    Listener->RemoveFromRoot();
+
+    return Result;
+}
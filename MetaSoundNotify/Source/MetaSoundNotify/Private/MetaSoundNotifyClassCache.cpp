@@ -0,0 +1,72 @@
+#include "MetaSoundNotifyClassCache.h"
+#include "MetaSoundNotifyInterface.h"
+#include "MetaSoundNotifyStats.h"
+
+DEFINE_STAT(STAT_MetaSoundNotifyClassCacheHits);
+DEFINE_STAT(STAT_MetaSoundNotifyClassCacheMisses);
+
+void FMetaSoundNotifyClassCache::Startup()
+{
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FMetaSoundNotifyClassCache::Reset);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FMetaSoundNotifyClassCache::OnReloadComplete);
+}
+
+void FMetaSoundNotifyClassCache::Shutdown()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    Reset();
+}
+
+const FMetaSoundNotifyClassInfo& FMetaSoundNotifyClassCache::GetClassInfo(const UClass* InClass)
+{
+    if (const FMetaSoundNotifyClassInfo* CachedInfo = Classes.Find(InClass))
+    {
+        INC_DWORD_STAT(STAT_MetaSoundNotifyClassCacheHits);
+        return *CachedInfo;
+    }
+
+    INC_DWORD_STAT(STAT_MetaSoundNotifyClassCacheMisses);
+
+    static const FName EventNames[] =
+    {
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotify),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyString),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyInt),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyFloat),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyBool),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyCuePoint),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyRawCuePoint),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyEvent),
+        GET_FUNCTION_NAME_CHECKED(IMetaSoundNotifyInterface, MetaSoundsNotifyBatch),
+    };
+    static_assert(UE_ARRAY_COUNT(EventNames) == static_cast<int32>(EMetaSoundNotifyListenerEvent::Count), "Missing listener event name.");
+
+    FMetaSoundNotifyClassInfo Info;
+    Info.bImplementsInterface = InClass->ImplementsInterface(UMetaSoundNotifyInterface::StaticClass());
+
+    if (Info.bImplementsInterface)
+    {
+        for (int32 EventIndex = 0; EventIndex < UE_ARRAY_COUNT(EventNames); ++EventIndex)
+        {
+            // Events that were not implemented resolve to the interface's own empty function (or nothing at all).
+            const UFunction* Function = InClass->FindFunctionByName(EventNames[EventIndex]);
+            if (Function && Function->GetOuter() != UMetaSoundNotifyInterface::StaticClass())
+            {
+                Info.ImplementedEvents |= 1u << EventIndex;
+            }
+        }
+    }
+
+    return Classes.Add(InClass, Info);
+}
+
+void FMetaSoundNotifyClassCache::Reset()
+{
+    Classes.Reset();
+}
+
+void FMetaSoundNotifyClassCache::OnReloadComplete(EReloadCompleteReason Reason)
+{
+    Reset();
+}
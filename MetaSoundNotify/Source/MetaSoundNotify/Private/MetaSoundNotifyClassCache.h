@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectGlobals.h"
+
+/** Interface events a listener class can implement. */
+enum class EMetaSoundNotifyListenerEvent : uint8
+{
+    Notify,
+    String,
+    Int,
+    Float,
+    Bool,
+    CuePoint,
+    RawCuePoint,
+    Event,
+    Batch,
+    Count
+};
+
+/**
+ * @name FMetaSoundNotifyClassInfo
+ * @brief What a listener class supports: the interface itself, and which of its events have an implementation.
+ */
+struct FMetaSoundNotifyClassInfo
+{
+    bool bImplementsInterface = false;
+    uint32 ImplementedEvents = 0;
+
+    bool Implements(EMetaSoundNotifyListenerEvent InEvent) const
+    {
+        return (ImplementedEvents & (1u << static_cast<uint32>(InEvent))) != 0;
+    }
+};
+
+/**
+ * @name FMetaSoundNotifyClassCache
+ * @brief Remembers, per listener class, whether it implements the MetaSound Notify interface and which events.
+ * Validating a listener is a single hash probe instead of walking the class hierarchy, and events nobody implemented
+ * are skipped instead of going through ProcessEvent for nothing. The cache is emptied after every garbage collection
+ * and class reload, so stale or reinstanced classes are never trusted. Game thread only.
+ */
+class FMetaSoundNotifyClassCache
+{
+public:
+    void Startup();
+    void Shutdown();
+
+    const FMetaSoundNotifyClassInfo& GetClassInfo(const UClass* InClass);
+
+    void Reset();
+
+private:
+    void OnReloadComplete(EReloadCompleteReason Reason);
+
+    TMap<const UClass*, FMetaSoundNotifyClassInfo> Classes;
+    FDelegateHandle PostGarbageCollectHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetasoundOperatorSettings.h"
+#include "MetaSoundNotifyDispatcher.h"
+
+/**
+ * @name FMetaSoundNotifyClock
+ * @brief Sample clock of an operator, counted from the moment the MetaSound started rendering.
+ * Operators stamp their records with it, so listeners know the exact sample a notify was sent at, not only the block.
+ */
+class FMetaSoundNotifyClock
+{
+public:
+    explicit FMetaSoundNotifyClock(const Metasound::FOperatorSettings& InSettings)
+    : SampleRate(InSettings.GetSampleRate())
+    , NumFramesPerBlock(InSettings.GetNumFramesPerBlock())
+    {
+    }
+
+    /** Stamps the record with the absolute sample of a frame of the current block. */
+    void Stamp(int32 InFrame, FMetaSoundNotifyRecord& OutRecord) const
+    {
+        OutRecord.SampleIndex = BlockStartSample + InFrame;
+        OutRecord.SampleRate = SampleRate;
+    }
+
+    /** Call once at the end of every Execute(). */
+    void AdvanceBlock()
+    {
+        BlockStartSample += NumFramesPerBlock;
+    }
+
+    int64 GetBlockStartSample() const
+    {
+        return BlockStartSample;
+    }
+
+    float GetSampleRate() const
+    {
+        return SampleRate;
+    }
+
+    int32 GetNumFramesPerBlock() const
+    {
+        return NumFramesPerBlock;
+    }
+
+private:
+    int64 BlockStartSample = 0;
+    float SampleRate = 0.0f;
+    int32 NumFramesPerBlock = 0;
+};
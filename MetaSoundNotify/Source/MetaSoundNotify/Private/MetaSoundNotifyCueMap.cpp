@@ -0,0 +1,99 @@
+#include "MetaSoundNotifyCueMap.h"
+#include "MetaSoundNotify.h"
+#include "MetaSoundNotifyWaveCueReader.h"
+#include "Algo/BinarySearch.h"
+
+void UMetaSoundNotifyCueMap::Build(const FMetaSoundNotifyWaveCues& InWaveCues)
+{
+    TArray<const FMetaSoundNotifyWaveCues::FCue*> SortedCues;
+    SortedCues.Reserve(InWaveCues.Cues.Num());
+    for (const FMetaSoundNotifyWaveCues::FCue& Cue : InWaveCues.Cues)
+    {
+        SortedCues.Add(&Cue);
+    }
+    SortedCues.StableSort([](const FMetaSoundNotifyWaveCues::FCue& A, const FMetaSoundNotifyWaveCues::FCue& B) { return A.SampleOffset < B.SampleOffset; });
+
+    SampleRate = InWaveCues.SampleRate;
+    SampleOffsets.Reset(SortedCues.Num());
+    CuePointIDs.Reset(SortedCues.Num());
+    LabelIndices.Reset(SortedCues.Num());
+    Labels.Reset();
+
+    TMap<FString, int32> InternedLabels;
+
+    for (const FMetaSoundNotifyWaveCues::FCue* Cue : SortedCues)
+    {
+        SampleOffsets.Add(Cue->SampleOffset);
+        CuePointIDs.Add(Cue->ID);
+
+        int32 LabelIndex = INDEX_NONE;
+        if (!Cue->Label.IsEmpty())
+        {
+            if (const int32* ExistingIndex = InternedLabels.Find(Cue->Label))
+            {
+                LabelIndex = *ExistingIndex;
+            }
+            else
+            {
+                LabelIndex = Labels.Add(Cue->Label);
+                InternedLabels.Add(Cue->Label, LabelIndex);
+            }
+        }
+        LabelIndices.Add(LabelIndex);
+    }
+
+    MarkPackageDirty();
+}
+
+bool UMetaSoundNotifyCueMap::ImportWaveFile(const FString& Filename)
+{
+    FMetaSoundNotifyWaveCues WaveCues;
+    FString Error;
+
+    if (!FMetaSoundNotifyWaveCueReader::ReadFile(Filename, WaveCues, Error))
+    {
+        UE_LOG(LogMetaSoundNotify, Warning, TEXT("Can't import cue points from %s: %s"), *Filename, *Error);
+        return false;
+    }
+
+    Build(WaveCues);
+    return true;
+}
+
+int32 UMetaSoundNotifyCueMap::GetNumCues() const
+{
+    return SampleOffsets.Num();
+}
+
+int32 UMetaSoundNotifyCueMap::FindNextCue(int64 SampleOffset) const
+{
+    return Algo::LowerBound(SampleOffsets, SampleOffset);
+}
+
+void UMetaSoundNotifyCueMap::FindCuesInRange(int64 StartSample, int64 EndSample, int32& FirstCue, int32& LastCue) const
+{
+    FirstCue = Algo::LowerBound(SampleOffsets, StartSample);
+    LastCue = FMath::Max(FirstCue, static_cast<int32>(Algo::LowerBound(SampleOffsets, EndSample)));
+}
+
+FString UMetaSoundNotifyCueMap::GetCueLabel(int32 CueIndex) const
+{
+    if (LabelIndices.IsValidIndex(CueIndex) && Labels.IsValidIndex(LabelIndices[CueIndex]))
+    {
+        return Labels[LabelIndices[CueIndex]];
+    }
+
+    return FString();
+}
+
+void UMetaSoundNotifyCueMap::GetCueTable(TArray<float>& OutPositions, TArray<FString>& OutLabels) const
+{
+    OutPositions.Reset(SampleOffsets.Num());
+    OutLabels.Reset(SampleOffsets.Num());
+
+    for (int32 CueIndex = 0; CueIndex < SampleOffsets.Num(); ++CueIndex)
+    {
+        OutPositions.Add(SampleRate > 0 ? static_cast<float>(SampleOffsets[CueIndex]) / SampleRate : 0.0f);
+        OutLabels.Add(GetCueLabel(CueIndex));
+    }
+}
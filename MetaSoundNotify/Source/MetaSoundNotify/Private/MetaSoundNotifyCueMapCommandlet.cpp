@@ -0,0 +1,92 @@
+#include "MetaSoundNotifyCueMapCommandlet.h"
+#include "MetaSoundNotify.h"
+#include "MetaSoundNotifyCueMap.h"
+#include "MetaSoundNotifyWaveCueReader.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UMetaSoundNotifyCueMapCommandlet::UMetaSoundNotifyCueMapCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UMetaSoundNotifyCueMapCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+    FString Source;
+    FString Destination = TEXT("/Game/CueMaps");
+
+    if (!FParse::Value(*Params, TEXT("Source="), Source))
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Usage: -run=MetaSoundNotifyCueMap -Source=<wav file or folder> [-Destination=/Game/CueMaps]"));
+        return 1;
+    }
+    FParse::Value(*Params, TEXT("Destination="), Destination);
+
+    TArray<FString> Files;
+    if (FPaths::FileExists(Source))
+    {
+        Files.Add(Source);
+    }
+    else
+    {
+        IFileManager::Get().FindFilesRecursive(Files, *Source, TEXT("*.wav"), true, false);
+    }
+
+    int32 NumFailed = 0;
+
+    for (const FString& File : Files)
+    {
+        FMetaSoundNotifyWaveCues WaveCues;
+        FString Error;
+
+        if (!FMetaSoundNotifyWaveCueReader::ReadFile(File, WaveCues, Error))
+        {
+            UE_LOG(LogMetaSoundNotify, Warning, TEXT("Skipping %s: %s"), *File, *Error);
+            ++NumFailed;
+            continue;
+        }
+
+        FString AssetName = FPaths::GetBaseFilename(File) + TEXT("_CueMap");
+        for (TCHAR& Char : AssetName.GetCharArray())
+        {
+            if (Char != TEXT('\0') && FCString::Strchr(INVALID_OBJECTNAME_CHARACTERS INVALID_LONGPACKAGE_CHARACTERS, Char))
+            {
+                Char = TEXT('_');
+            }
+        }
+
+        const FString PackageName = Destination / AssetName;
+        UPackage* Package = CreatePackage(*PackageName);
+        UMetaSoundNotifyCueMap* CueMap = NewObject<UMetaSoundNotifyCueMap>(Package, *AssetName, RF_Public | RF_Standalone);
+        CueMap->Build(WaveCues);
+
+        const FString PackageFilename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+
+        if (!UPackage::SavePackage(Package, CueMap, *PackageFilename, SaveArgs))
+        {
+            UE_LOG(LogMetaSoundNotify, Warning, TEXT("Can't save %s."), *PackageFilename);
+            ++NumFailed;
+            continue;
+        }
+
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("%s: %d cue points, %d labels -> %s"), *File, CueMap->GetNumCues(), CueMap->Labels.Num(), *PackageName);
+    }
+
+    UE_LOG(LogMetaSoundNotify, Display, TEXT("Processed %d wave files, %d failed."), Files.Num(), NumFailed);
+
+    return NumFailed == 0 ? 0 : 1;
+#else
+    UE_LOG(LogMetaSoundNotify, Error, TEXT("The MetaSoundNotifyCueMap commandlet needs an editor build to save assets."));
+    return 1;
+#endif
+}
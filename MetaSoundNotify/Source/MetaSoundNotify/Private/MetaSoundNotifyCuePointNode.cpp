@@ -1,6 +1,9 @@
 #include "MetasoundParamHelper.h"
 #include "MetasoundEnumRegistrationMacro.h"
-#include "MetaSoundNotifyInterface.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyCuePointNode"
 
@@ -10,7 +13,8 @@ namespace Metasound
     namespace NotifyCuePointNode
     {
         METASOUND_PARAM(InParamNameTrigger, "On Cue Point", "Executes the node behaviour to send the message.")
-        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string.")
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
         METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
         METASOUND_PARAM(InParamNameID, "Cue Point ID", "Index of the cue point.")
         METASOUND_PARAM(InParamNameLabel, "Label", "Label of the cue point.")
@@ -27,8 +31,10 @@ namespace Metasound
         static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
 
         FNotifyCuePointOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
         const FTriggerReadRef& InCuePointInput,
         const FStringReadRef& InAddressInput,
+        const FInt32ReadRef& InListenerHandleInput,
         const FInt32ReadRef& InIDInput,
         const FInt32ReadRef& InIndexInput,
         const FStringReadRef& InLabelInput);
@@ -41,28 +47,38 @@ namespace Metasound
     private:
         FTriggerReadRef TriggerCuePointInput;
         FStringReadRef AddressInput;
+        FInt32ReadRef ListenerHandleInput;
         FInt32ReadRef IDInput;
         FInt32ReadRef IndexInput;
         FStringReadRef LabelInput;
         
         FTriggerWriteRef SentTrigger;
+
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+        FMetaSoundNotifyMessageCache LabelCache;
         
-        void SendMessageToListener();
+        void SendMessageToListener(int32 InFrame);
     };
     
     FNotifyCuePointOperator::FNotifyCuePointOperator(const FOperatorSettings& InSettings,
+    const FMetasoundEnvironment& InEnvironment,
     const FTriggerReadRef& InCuePointInput,
     const FStringReadRef& InAddressInput,
+    const FInt32ReadRef& InListenerHandleInput,
     const FInt32ReadRef& InIDInput,
     const FInt32ReadRef& InIndexInput,
     const FStringReadRef& InLabelInput)
     :
     TriggerCuePointInput(InCuePointInput),
     AddressInput(InAddressInput),
+    ListenerHandleInput(InListenerHandleInput),
     IDInput(InIDInput),
     IndexInput(InIndexInput),
     LabelInput(InLabelInput),
-    SentTrigger(FTriggerWriteRef::CreateNew(InSettings))
+    SentTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    ListenerCache(InEnvironment),
+    Clock(InSettings)
     {
     }
 
@@ -74,6 +90,7 @@ namespace Metasound
 
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameTrigger), TriggerCuePointInput);
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameID), IndexInput);        
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameLabel), LabelInput);
@@ -94,6 +111,8 @@ namespace Metasound
 
     void FNotifyCuePointOperator::Execute()
     {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
 		SentTrigger->AdvanceBlock();
         
         TriggerCuePointInput->ExecuteBlock(
@@ -102,10 +121,12 @@ namespace Metasound
 			},
 			[this](int32 StartFrame, int32 EndFrame)
 			{
-                SendMessageToListener();
+                SendMessageToListener(StartFrame);
                 SentTrigger->TriggerFrame(StartFrame);
 			}
 		);
+
+        Clock.AdvanceBlock();
     }
 
     const FVertexInterface& FNotifyCuePointOperator::GetVertexInterface()
@@ -116,6 +137,7 @@ namespace Metasound
             FInputVertexInterface(
                 TInputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameTrigger)),
                 TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
                 TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID)),
                 TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameID)),
                 TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameLabel))
@@ -137,7 +159,7 @@ namespace Metasound
 
             Info.ClassName        = { TEXT("UE"), TEXT("NotifyCuePoint"), TEXT("Notify Cue Point") };
             Info.MajorVersion     = 1;
-            Info.MinorVersion     = 0;
+            Info.MinorVersion     = 1;
             Info.DisplayName      = LOCTEXT("Metasound_NotifyCuePointDisplayName", "Notify Cue Point");
             Info.Description      = LOCTEXT("Metasound_NotifyCuePointNodeDescription", "Useful to send a cue point notify, with optional cue point index and label. It does not check if the cue point is reached! This just sends the message out. If you don't have cue points in your audio file, you can try using Notify Raw Cue Point.");
             Info.Author           = PluginAuthor;
@@ -162,21 +184,29 @@ namespace Metasound
         
         FTriggerReadRef TriggerIn = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamNameTrigger), InParams.OperatorSettings);
         FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
         FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
         FInt32ReadRef IndexIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameID), InParams.OperatorSettings);
         FStringReadRef LabelIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameLabel), InParams.OperatorSettings);
 
-        return MakeUnique<FNotifyCuePointOperator>(InParams.OperatorSettings, TriggerIn, AddressIn, IDIn, IndexIn, LabelIn);
+        return MakeUnique<FNotifyCuePointOperator>(InParams.OperatorSettings, InParams.Environment, TriggerIn, AddressIn, ListenerHandleIn, IDIn, IndexIn, LabelIn);
     }
 
-    void FNotifyCuePointOperator::SendMessageToListener(){
-        FSoftObjectPath SoftTarget(*AddressInput);
-        TSoftObjectPtr<UObject> SoftTargetPtr(SoftTarget);
-        UObject* Target = SoftTargetPtr.Get();
+    void FNotifyCuePointOperator::SendMessageToListener(int32 InFrame){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
 
-        if (Target && Target->GetClass()->ImplementsInterface(UMetaSoundNotifyInterface::StaticClass()))
+        FMetaSoundNotifyRecord Record;
+
+        if (ListenerCache.Resolve(*AddressInput, *ListenerHandleInput, Record.Listener))
         {
-            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyCuePoint(Target, *IDInput, *IndexInput, *LabelInput);
+            Record.Type = EMetaSoundNotifyType::CuePoint;
+            Record.NotifyID = *IDInput;
+            Record.IntValue = *IndexInput;
+            Record.Message = LabelCache.Intern(*LabelInput);
+
+            Clock.Stamp(InFrame, Record);
+
+            FMetaSoundNotifyDispatcher::Get().Enqueue(Record);
         }
     }
     #pragma endregion
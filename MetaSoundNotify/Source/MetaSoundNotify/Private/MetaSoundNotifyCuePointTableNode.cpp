@@ -0,0 +1,343 @@
+#include "MetasoundParamHelper.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundPrimitives.h"
+#include "Algo/BinarySearch.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyCuePointTableNode"
+
+namespace Metasound
+{
+    #pragma region PARAMETERS
+    namespace NotifyCuePointTableNode
+    {
+        METASOUND_PARAM(InParamNameReset, "Reset", "Reloads the cue point table and moves the cursor to the current playback position. Trigger it after changing the positions.")
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
+        METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
+        METASOUND_PARAM(InParamNamePlayback, "Playback Position", "Current playback position of the sound.")
+        METASOUND_PARAM(InParamNamePositions, "Cue Point Positions", "Positions of the virtual cue points, in the same unit as the playback position. They don't need to be sorted.")
+        METASOUND_PARAM(InParamNameLabels, "Cue Point Labels", "Optional label of every cue point, sent along with its index.")
+        METASOUND_PARAM(OutParamNameSent, "On Sent", "Triggered for every cue point we send a notify for.")
+    }
+    #pragma endregion
+
+    #pragma region OPERATOR
+    class FNotifyCuePointTableOperator : public TExecutableOperator<FNotifyCuePointTableOperator>
+    {
+    public:
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        using FFloatArrayReadRef = TDataReadReference<TArray<float>>;
+        using FStringArrayReadRef = TDataReadReference<TArray<FString>>;
+
+        FNotifyCuePointTableOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
+        const FTriggerReadRef& InResetInput,
+        const FStringReadRef& InAddressInput,
+        const FInt32ReadRef& InListenerHandleInput,
+        const FInt32ReadRef& InIDInput,
+        const FFloatReadRef& InPlaybackInput,
+        const FFloatArrayReadRef& InPositionsInput,
+        const FStringArrayReadRef& InLabelsInput);
+
+        virtual FDataReferenceCollection GetInputs()  const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+
+        void Execute();
+
+    private:
+        struct FCue
+        {
+            float Position;
+            int32 Index;
+        };
+
+        FTriggerReadRef ResetInput;
+        FStringReadRef AddressInput;
+        FInt32ReadRef ListenerHandleInput;
+        FInt32ReadRef IDInput;
+        FFloatReadRef PlaybackInput;
+        FFloatArrayReadRef PositionsInput;
+        FStringArrayReadRef LabelsInput;
+
+        FTriggerWriteRef SentTrigger;
+
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+
+        // Cue points sorted by position. Only rebuilt when the table is reloaded.
+        TArray<FCue> Cues;
+        // Interned label of every cue point, by index in the table. Only grows, can hold more caches than cue points.
+        TArray<FMetaSoundNotifyMessageCache> LabelCaches;
+        // Index in Cues of the next cue point to cross.
+        int32 Cursor = 0;
+        float LastPlayback = 0.0f;
+        // How much the playback position moved during the last block it moved forward.
+        float PlaybackStep = 0.0f;
+
+        void ReloadTable();
+        void SendMessageToListener(int32 InFrame, int32 InCueIndex);
+    };
+
+    FNotifyCuePointTableOperator::FNotifyCuePointTableOperator(const FOperatorSettings& InSettings,
+    const FMetasoundEnvironment& InEnvironment,
+    const FTriggerReadRef& InResetInput,
+    const FStringReadRef& InAddressInput,
+    const FInt32ReadRef& InListenerHandleInput,
+    const FInt32ReadRef& InIDInput,
+    const FFloatReadRef& InPlaybackInput,
+    const FFloatArrayReadRef& InPositionsInput,
+    const FStringArrayReadRef& InLabelsInput)
+    :
+    ResetInput(InResetInput),
+    AddressInput(InAddressInput),
+    ListenerHandleInput(InListenerHandleInput),
+    IDInput(InIDInput),
+    PlaybackInput(InPlaybackInput),
+    PositionsInput(InPositionsInput),
+    LabelsInput(InLabelsInput),
+    SentTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    ListenerCache(InEnvironment),
+    Clock(InSettings)
+    {
+        ReloadTable();
+    }
+
+    FDataReferenceCollection FNotifyCuePointTableOperator::GetInputs() const
+    {
+        using namespace NotifyCuePointTableNode;
+
+        FDataReferenceCollection InputDataReferences;
+
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameReset), ResetInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNamePlayback), PlaybackInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNamePositions), PositionsInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameLabels), LabelsInput);
+
+        return InputDataReferences;
+    }
+
+    FDataReferenceCollection FNotifyCuePointTableOperator::GetOutputs() const
+    {
+        using namespace NotifyCuePointTableNode;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameSent), SentTrigger);
+
+        return OutputDataReferences;
+    }
+
+    void FNotifyCuePointTableOperator::Execute()
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
+        SentTrigger->AdvanceBlock();
+
+        ResetInput->ExecuteBlock(
+			[](int32, int32)
+			{
+			},
+			[this](int32 StartFrame, int32 EndFrame)
+			{
+                ReloadTable();
+			}
+		);
+
+        // A different amount of positions means the table changed for sure.
+        if (PositionsInput->Num() != Cues.Num())
+        {
+            ReloadTable();
+        }
+
+        const float Playback = *PlaybackInput;
+        const int32 NumFrames = Clock.GetNumFramesPerBlock();
+
+        if (Playback < LastPlayback)
+        {
+            // Playback went backwards (loop or seek). On a loop the block went from the last position to the loop end,
+            // then from the loop start to the current position, one step in total. Cue points in the tail go first.
+            if (PlaybackStep > 0.0f)
+            {
+                while (Cursor < Cues.Num() && Cues[Cursor].Position <= LastPlayback + PlaybackStep)
+                {
+                    const float Alpha = (Cues[Cursor].Position - LastPlayback) / PlaybackStep;
+                    const int32 Frame = FMath::Clamp(FMath::FloorToInt(Alpha * NumFrames), 0, NumFrames - 1);
+
+                    SendMessageToListener(Frame, Cues[Cursor].Index);
+                    SentTrigger->TriggerFrame(Frame);
+                    ++Cursor;
+                }
+            }
+
+            // Then move the cursor back to where the block most likely started, one step before the current position
+            // (with a bit of slack so a cue point right at the loop start isn't missed). Binary search, only on jumps.
+            LastPlayback = Playback - PlaybackStep - KINDA_SMALL_NUMBER;
+            Cursor = Algo::LowerBoundBy(Cues, LastPlayback, &FCue::Position);
+        }
+        else if (Playback > LastPlayback)
+        {
+            PlaybackStep = Playback - LastPlayback;
+        }
+
+        // Only the cue points crossed during this block are visited.
+        const float Distance = Playback - LastPlayback;
+
+        while (Cursor < Cues.Num() && Cues[Cursor].Position <= Playback)
+        {
+            // Place the crossing inside the block, assuming the playback moved linearly.
+            int32 Frame = 0;
+            if (Distance > 0.0f)
+            {
+                const float Alpha = (Cues[Cursor].Position - LastPlayback) / Distance;
+                Frame = FMath::Clamp(FMath::FloorToInt(Alpha * NumFrames), 0, NumFrames - 1);
+            }
+
+            SendMessageToListener(Frame, Cues[Cursor].Index);
+            SentTrigger->TriggerFrame(Frame);
+            ++Cursor;
+        }
+
+        LastPlayback = Playback;
+        Clock.AdvanceBlock();
+    }
+
+    const FVertexInterface& FNotifyCuePointTableOperator::GetVertexInterface()
+    {
+        using namespace NotifyCuePointTableNode;
+
+        static const FVertexInterface Interface(
+            FInputVertexInterface(
+                TInputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameReset)),
+                TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID)),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePlayback)),
+                TInputDataVertexModel<TArray<float>>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePositions)),
+                TInputDataVertexModel<TArray<FString>>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameLabels))
+            ),
+
+            FOutputVertexInterface(
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameSent))
+            )
+        );
+
+        return Interface;
+    }
+
+    const FNodeClassMetadata& FNotifyCuePointTableOperator::GetNodeInfo()
+    {
+        auto InitNodeInfo = []() -> FNodeClassMetadata
+        {
+            FNodeClassMetadata Info;
+
+            Info.ClassName        = { TEXT("UE"), TEXT("NotifyCuePointTable"), TEXT("Notify Cue Point Table") };
+            Info.MajorVersion     = 1;
+            Info.MinorVersion     = 0;
+            Info.DisplayName      = LOCTEXT("Metasound_NotifyCuePointTableDisplayName", "Notify Cue Point Table");
+            Info.Description      = LOCTEXT("Metasound_NotifyCuePointTableNodeDescription", "Like Notify Raw Cue Point, but for a whole table of virtual cue points. Sends a cue point notify (index and label) for every cue point the playback position crosses, and re-arms them when the playback jumps back, for example when looping.");
+            Info.Author           = PluginAuthor;
+            Info.PromptIfMissing  = PluginNodeMissingPrompt;
+            Info.DefaultInterface = GetVertexInterface();
+            Info.CategoryHierarchy = { LOCTEXT("Metasound_NotifyCuePointTableNodeCategory", "Notify") };
+
+            return Info;
+        };
+
+        static const FNodeClassMetadata Info = InitNodeInfo();
+
+        return Info;
+    }
+
+    TUniquePtr<IOperator> FNotifyCuePointTableOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace NotifyCuePointTableNode;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FTriggerReadRef ResetIn = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamNameReset), InParams.OperatorSettings);
+        FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
+        FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
+        FFloatReadRef PlaybackIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNamePlayback), InParams.OperatorSettings);
+        FFloatArrayReadRef PositionsIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<TArray<float>>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNamePositions), InParams.OperatorSettings);
+        FStringArrayReadRef LabelsIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<TArray<FString>>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameLabels), InParams.OperatorSettings);
+
+        return MakeUnique<FNotifyCuePointTableOperator>(InParams.OperatorSettings, InParams.Environment, ResetIn, AddressIn, ListenerHandleIn, IDIn, PlaybackIn, PositionsIn, LabelsIn);
+    }
+
+    void FNotifyCuePointTableOperator::ReloadTable(){
+        const TArray<float>& Positions = *PositionsInput;
+
+        // Keeps the memory of the previous table, so reloading only allocates when the table grows. The first reload
+        // happens in the constructor, off the render thread.
+        Cues.Reset(Positions.Num());
+        for (int32 Index = 0; Index < Positions.Num(); ++Index)
+        {
+            Cues.Add({ Positions[Index], Index });
+        }
+
+        // Label caches are kept across reloads, a label that didn't change is still interned.
+        // Labels rarely change, a single pooled message per cue point is enough.
+        LabelCaches.Reserve(Positions.Num());
+        while (LabelCaches.Num() < Positions.Num())
+        {
+            LabelCaches.Emplace(1);
+        }
+
+        Cues.StableSort([](const FCue& A, const FCue& B) { return A.Position < B.Position; });
+
+        // Start from the current position: cue points we are already past are not sent.
+        LastPlayback = *PlaybackInput;
+        Cursor = Algo::LowerBoundBy(Cues, LastPlayback, &FCue::Position);
+    }
+
+    void FNotifyCuePointTableOperator::SendMessageToListener(int32 InFrame, int32 InCueIndex){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
+
+        FMetaSoundNotifyRecord Record;
+
+        if (ListenerCache.Resolve(*AddressInput, *ListenerHandleInput, Record.Listener))
+        {
+            const TArray<FString>& Labels = *LabelsInput;
+
+            Record.Type = EMetaSoundNotifyType::CuePoint;
+            Record.NotifyID = *IDInput;
+            Record.IntValue = InCueIndex;
+            if (Labels.IsValidIndex(InCueIndex) && LabelCaches.IsValidIndex(InCueIndex))
+            {
+                Record.Message = LabelCaches[InCueIndex].Intern(Labels[InCueIndex]);
+            }
+
+            Clock.Stamp(InFrame, Record);
+
+            FMetaSoundNotifyDispatcher::Get().Enqueue(Record);
+        }
+    }
+    #pragma endregion
+
+    #pragma region NODE
+    class FNotifyCuePointTableNode : public FNodeFacade
+    {
+    public:
+        FNotifyCuePointTableNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FNotifyCuePointTableOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FNotifyCuePointTableNode)
+    #pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
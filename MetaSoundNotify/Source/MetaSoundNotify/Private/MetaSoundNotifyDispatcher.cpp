@@ -0,0 +1,476 @@
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotify.h"
+#include "MetaSoundNotifyInterface.h"
+#include "MetaSoundNotifySubsystem.h"
+#include "MetaSoundNotifyStats.h"
+#include "MetaSoundNotifyRecorder.h"
+#include "Components/AudioComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Trace/Trace.inl"
+#include "UObject/SoftObjectPath.h"
+
+DEFINE_STAT(STAT_MetaSoundNotifyExecute);
+DEFINE_STAT(STAT_MetaSoundNotifySend);
+DEFINE_STAT(STAT_MetaSoundNotifyDrain);
+DEFINE_STAT(STAT_MetaSoundNotifySends);
+DEFINE_STAT(STAT_MetaSoundNotifyFailedResolves);
+DEFINE_STAT(STAT_MetaSoundNotifyInterfaceMisses);
+DEFINE_STAT(STAT_MetaSoundNotifyDeferred);
+DEFINE_STAT(STAT_MetaSoundNotifyLate);
+
+// Insights channel, enable it with -trace=metasoundnotify.
+UE_TRACE_CHANNEL_DEFINE(MetaSoundNotifyChannel)
+
+UE_TRACE_EVENT_BEGIN(MetaSoundNotify, Send)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(int64, SampleIndex)
+    UE_TRACE_EVENT_FIELD(int32, NotifyID)
+    UE_TRACE_EVENT_FIELD(uint8, Type)
+    UE_TRACE_EVENT_FIELD(bool, bQueued)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MetaSoundNotify, Deliver)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(int64, SampleIndex)
+    UE_TRACE_EVENT_FIELD(int32, NotifyID)
+    UE_TRACE_EVENT_FIELD(uint8, Type)
+    UE_TRACE_EVENT_FIELD(uint32, ListenerId)
+UE_TRACE_EVENT_END()
+
+static float GMetaSoundNotifyDrainBudgetUs = 0.0f;
+static FAutoConsoleVariableRef CVarMetaSoundNotifyDrainBudgetUs(
+    TEXT("au.MetaSoundNotify.DrainBudgetUs"),
+    GMetaSoundNotifyDrainBudgetUs,
+    TEXT("Time in microseconds the game thread may spend delivering notifies per frame. What doesn't fit is delivered on the next frames, cue points first.\n")
+    TEXT("0: no budget, every notify is delivered on the frame it arrives (default)"),
+    ECVF_Default);
+
+FMetaSoundNotifyDispatcher& FMetaSoundNotifyDispatcher::Get()
+{
+    static FMetaSoundNotifyDispatcher Dispatcher;
+    return Dispatcher;
+}
+
+FMetaSoundNotifyDispatcher::FMetaSoundNotifyDispatcher()
+: Queue(QueueCapacity)
+{
+}
+
+void FMetaSoundNotifyDispatcher::Startup()
+{
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMetaSoundNotifyDispatcher::Tick));
+        ClassCache.Startup();
+    }
+}
+
+void FMetaSoundNotifyDispatcher::Shutdown()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+        ClassCache.Shutdown();
+    }
+
+    // Throw away whatever is left, listeners may already be gone.
+    while (Queue.Pop(Pending))
+    {
+    }
+
+    for (FBacklog& Backlog : Backlogs)
+    {
+        Backlog.Notifies.Empty();
+        Backlog.Head = 0;
+    }
+}
+
+bool FMetaSoundNotifyDispatcher::Enqueue(const FMetaSoundNotifyRecord& InRecord, bool bInRecord)
+{
+    INC_DWORD_STAT(STAT_MetaSoundNotifySends);
+
+    const bool bQueued = Queue.Push(InRecord);
+
+    // Only what the game actually receives is recorded, so a replay sends the same notifies.
+    FMetaSoundNotifyRecorder& Recorder = FMetaSoundNotifyRecorder::Get();
+    if (bQueued && bInRecord && Recorder.IsRecording())
+    {
+        Recorder.Capture(InRecord);
+    }
+
+    UE_TRACE_LOG(MetaSoundNotify, Send, MetaSoundNotifyChannel)
+        << Send.Cycle(FPlatformTime::Cycles64())
+        << Send.SampleIndex(InRecord.SampleIndex)
+        << Send.NotifyID(InRecord.NotifyID)
+        << Send.Type(static_cast<uint8>(InRecord.Type))
+        << Send.bQueued(bQueued);
+
+    if (bQueued)
+    {
+        return true;
+    }
+
+    NumDropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool FMetaSoundNotifyDispatcher::Tick(float DeltaTime)
+{
+    Drain(GMetaSoundNotifyDrainBudgetUs * 1e-6);
+    return true;
+}
+
+EMetaSoundNotifyPriority FMetaSoundNotifyDispatcher::GetPriority(EMetaSoundNotifyType InType)
+{
+    switch (InType)
+    {
+    case EMetaSoundNotifyType::CuePoint:
+    case EMetaSoundNotifyType::RawCuePoint:
+    case EMetaSoundNotifyType::Beat:
+        return EMetaSoundNotifyPriority::Cue;
+    case EMetaSoundNotifyType::Int:
+    case EMetaSoundNotifyType::Float:
+    case EMetaSoundNotifyType::Bool:
+    case EMetaSoundNotifyType::Time:
+    case EMetaSoundNotifyType::AudioSnapshot:
+        return EMetaSoundNotifyPriority::Value;
+    default:
+        return EMetaSoundNotifyPriority::Event;
+    }
+}
+
+void FMetaSoundNotifyDispatcher::Drain(double InBudgetSeconds)
+{
+    check(IsInGameThread());
+    SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyDrain);
+
+    Subsystem = UMetaSoundNotifySubsystem::Get();
+    ++DrainCount;
+
+    bool bHasBacklog = false;
+    for (const FBacklog& Backlog : Backlogs)
+    {
+        bHasBacklog |= Backlog.Num() > 0;
+    }
+
+    if (InBudgetSeconds <= 0.0 && !bHasBacklog)
+    {
+        // No budget, delivered straight out of the queue in the order they were sent.
+        while (Queue.Pop(Pending))
+        {
+            Deliver(Pending);
+
+            // Don't keep the payloads alive until the next notify, their node may want to recycle them.
+            Pending.AudioBlock.SafeRelease();
+            Pending.Message.SafeRelease();
+        }
+    }
+    else
+    {
+        // Sort everything that arrived by priority, behind what previous drains couldn't deliver.
+        while (Queue.Pop(Pending))
+        {
+            FBacklog& Backlog = Backlogs[static_cast<int32>(GetPriority(Pending.Type))];
+            FBacklogNotify& Notify = Backlog.Notifies.AddDefaulted_GetRef();
+            Notify.Record = MoveTemp(Pending);
+            Notify.DrainCount = DrainCount;
+        }
+
+        const uint64 EndCycles = InBudgetSeconds > 0.0 ? FPlatformTime::Cycles64() + static_cast<uint64>(InBudgetSeconds / FPlatformTime::GetSecondsPerCycle64()) : MAX_uint64;
+        DrainBacklog(EndCycles);
+    }
+
+    FlushBatches();
+
+    Subsystem = nullptr;
+
+    if (const uint32 Dropped = NumDropped.exchange(0, std::memory_order_relaxed))
+    {
+        UE_LOG(LogMetaSoundNotify, Warning, TEXT("Notify queue was full, %u notifies were dropped."), Dropped);
+    }
+}
+
+void FMetaSoundNotifyDispatcher::DrainBacklog(uint64 InEndCycles)
+{
+    int32 NumDeferred = 0;
+    bool bOutOfBudget = false;
+
+    for (FBacklog& Backlog : Backlogs)
+    {
+        while (!bOutOfBudget && Backlog.Head < Backlog.Notifies.Num())
+        {
+            FBacklogNotify& Notify = Backlog.Notifies[Backlog.Head++];
+
+            if (Notify.DrainCount != DrainCount)
+            {
+                INC_DWORD_STAT(STAT_MetaSoundNotifyLate);
+            }
+
+            Deliver(Notify.Record);
+            Notify.Record.AudioBlock.SafeRelease();
+            Notify.Record.Message.SafeRelease();
+
+            // At least one notify is delivered per drain, so a tiny budget still makes progress.
+            bOutOfBudget = FPlatformTime::Cycles64() >= InEndCycles;
+        }
+
+        NumDeferred += Backlog.Num();
+
+        if (Backlog.Num() == 0)
+        {
+            Backlog.Notifies.Reset();
+            Backlog.Head = 0;
+        }
+        else if (Backlog.Head > Backlog.Notifies.Num() / 2)
+        {
+            // Keep a backlog that never empties from growing forever.
+            Backlog.Notifies.RemoveAt(0, Backlog.Head, false);
+            Backlog.Head = 0;
+        }
+    }
+
+    SET_DWORD_STAT(STAT_MetaSoundNotifyDeferred, NumDeferred);
+}
+
+UObject* FMetaSoundNotifyAddress::Resolve() const
+{
+    check(IsInGameThread());
+
+    if (UObject* Object = Listener.Get())
+    {
+        return Object;
+    }
+
+    // Not spawned yet or destroyed. Looked up again at most once per frame, so a wrong address stays cheap.
+    if (LastResolveFrame != GFrameCounter)
+    {
+        LastResolveFrame = GFrameCounter;
+        Listener = FSoftObjectPath(Text).ResolveObject();
+    }
+
+    return Listener.Get();
+}
+
+UObject* FMetaSoundNotifyDispatcher::ResolveTarget(const FMetaSoundNotifyListener& InListener, const UMetaSoundNotifySubsystem* InSubsystem)
+{
+    if (InListener.Handle != 0)
+    {
+        return InSubsystem ? InSubsystem->GetListener(InListener.Handle) : nullptr;
+    }
+    else if (InListener.OwnerComponentID != 0)
+    {
+        // Owner of the audio component playing the MetaSound, or the component itself if nothing owns it.
+        if (UAudioComponent* AudioComponent = UAudioComponent::GetAudioComponentFromID(InListener.OwnerComponentID))
+        {
+            AActor* Owner = AudioComponent->GetOwner();
+            return Owner ? static_cast<UObject*>(Owner) : AudioComponent;
+        }
+
+        return nullptr;
+    }
+    else if (InListener.Address.IsValid())
+    {
+        UObject* Target = InListener.Address->Resolve();
+        if (!Target)
+        {
+            INC_DWORD_STAT(STAT_MetaSoundNotifyFailedResolves);
+        }
+
+        return Target;
+    }
+
+    return InListener.Object.Get();
+}
+
+void FMetaSoundNotifyDispatcher::Deliver(const FMetaSoundNotifyRecord& InRecord)
+{
+    if (!InRecord.Listener.Group.IsNone())
+    {
+        // One notify, every member of the group. The member array only changes on join and leave.
+        const TArray<TWeakObjectPtr<UObject>>* Members = Subsystem ? Subsystem->FindGroupMembers(InRecord.Listener.Group) : nullptr;
+
+        if (Members)
+        {
+            GroupMembers = *Members;
+
+            for (const TWeakObjectPtr<UObject>& Member : GroupMembers)
+            {
+                if (UObject* MemberObject = Member.Get())
+                {
+                    DeliverTo(MemberObject, InRecord);
+                }
+            }
+
+            GroupMembers.Reset();
+        }
+
+        return;
+    }
+
+    UObject* Target = ResolveTarget(InRecord.Listener, Subsystem);
+
+    // The listener may have been destroyed or unregistered since the render thread pushed the notify.
+    if (!Target)
+    {
+        INC_DWORD_STAT(STAT_MetaSoundNotifyFailedResolves);
+        return;
+    }
+
+    DeliverTo(Target, InRecord);
+}
+
+void FMetaSoundNotifyDispatcher::DeliverTo(UObject* Target, const FMetaSoundNotifyRecord& InRecord)
+{
+    UE_TRACE_LOG(MetaSoundNotify, Deliver, MetaSoundNotifyChannel)
+        << Deliver.Cycle(FPlatformTime::Cycles64())
+        << Deliver.SampleIndex(InRecord.SampleIndex)
+        << Deliver.NotifyID(InRecord.NotifyID)
+        << Deliver.Type(static_cast<uint8>(InRecord.Type))
+        << Deliver.ListenerId(Target->GetUniqueID());
+
+    // Native listeners are called directly, no ProcessEvent and no parameter marshalling. Notifies none of their bindings
+    // match fall back to the interface.
+    if (Subsystem && Subsystem->HasNativeListener(Target, InRecord.NotifyID))
+    {
+        MakeEvent(InRecord, ScratchEvent);
+        Subsystem->ExecuteNativeListener(Target, ScratchEvent);
+        ScratchEvent.Snapshot.Reset();
+        return;
+    }
+
+    const FMetaSoundNotifyClassInfo& ClassInfo = ClassCache.GetClassInfo(Target->GetClass());
+    if (!ClassInfo.bImplementsInterface)
+    {
+        INC_DWORD_STAT(STAT_MetaSoundNotifyInterfaceMisses);
+        return;
+    }
+
+    // Listeners implementing the batch event get everything in one call at the end of the drain.
+    if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::Batch))
+    {
+        AddToBatch(Target, InRecord);
+        return;
+    }
+
+    // Typed event of the node, skipped if the listener didn't implement it.
+    switch (InRecord.Type)
+    {
+    case EMetaSoundNotifyType::Notify:
+        if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::Notify))
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotify(Target, InRecord.NotifyID);
+        }
+        break;
+    case EMetaSoundNotifyType::String:
+        if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::String))
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyString(Target, InRecord.NotifyID, FMetaSoundNotifyMessage::GetTextOrEmpty(InRecord.Message));
+        }
+        break;
+    case EMetaSoundNotifyType::Int:
+        if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::Int))
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyInt(Target, InRecord.NotifyID, InRecord.IntValue);
+        }
+        break;
+    case EMetaSoundNotifyType::Float:
+        if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::Float))
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyFloat(Target, InRecord.NotifyID, InRecord.FloatValue);
+        }
+        break;
+    case EMetaSoundNotifyType::Bool:
+        if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::Bool))
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyBool(Target, InRecord.NotifyID, InRecord.bBoolValue);
+        }
+        break;
+    case EMetaSoundNotifyType::CuePoint:
+        if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::CuePoint))
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyCuePoint(Target, InRecord.NotifyID, InRecord.IntValue, FMetaSoundNotifyMessage::GetTextOrEmpty(InRecord.Message));
+        }
+        break;
+    case EMetaSoundNotifyType::RawCuePoint:
+        if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::RawCuePoint))
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyRawCuePoint(Target, InRecord.NotifyID, FMetaSoundNotifyMessage::GetTextOrEmpty(InRecord.Message));
+        }
+        break;
+    default:
+        // Newer node types only have the generic and batch events.
+        break;
+    }
+
+    // Generic event with the full payload and timestamp.
+    if (ClassInfo.Implements(EMetaSoundNotifyListenerEvent::Event))
+    {
+        MakeEvent(InRecord, ScratchEvent);
+        IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyEvent(Target, ScratchEvent);
+        ScratchEvent.Snapshot.Reset();
+    }
+}
+
+void FMetaSoundNotifyDispatcher::AddToBatch(UObject* InListener, const FMetaSoundNotifyRecord& InRecord)
+{
+    int32 BatchIndex = INDEX_NONE;
+
+    if (const int32* ExistingIndex = BatchIndices.Find(InListener))
+    {
+        BatchIndex = *ExistingIndex;
+    }
+    else
+    {
+        BatchIndex = NumActiveBatches++;
+        if (!Batches.IsValidIndex(BatchIndex))
+        {
+            Batches.AddDefaulted();
+        }
+
+        Batches[BatchIndex].Listener = InListener;
+        BatchIndices.Add(InListener, BatchIndex);
+    }
+
+    TArray<FMetaSoundNotifyEvent>& Events = Batches[BatchIndex].Events;
+    MakeEvent(InRecord, Events.AddDefaulted_GetRef());
+}
+
+void FMetaSoundNotifyDispatcher::FlushBatches()
+{
+    for (int32 BatchIndex = 0; BatchIndex < NumActiveBatches; ++BatchIndex)
+    {
+        FListenerBatch& Batch = Batches[BatchIndex];
+
+        // A previous listener of this drain may have destroyed this one.
+        if (UObject* Listener = Batch.Listener.Get())
+        {
+            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyBatch(Listener, Batch.Events);
+        }
+
+        Batch.Listener.Reset();
+        Batch.Events.Reset();
+    }
+
+    NumActiveBatches = 0;
+    BatchIndices.Reset();
+}
+
+void FMetaSoundNotifyDispatcher::MakeEvent(const FMetaSoundNotifyRecord& InRecord, FMetaSoundNotifyEvent& OutEvent)
+{
+    OutEvent.Type = InRecord.Type;
+    OutEvent.NotifyID = InRecord.NotifyID;
+    OutEvent.IntValue = InRecord.IntValue;
+    OutEvent.FloatValue = InRecord.FloatValue;
+    OutEvent.bBoolValue = InRecord.bBoolValue;
+    // The string only gets copied here, for listeners of the full payload.
+    OutEvent.Message = FMetaSoundNotifyMessage::GetTextOrEmpty(InRecord.Message);
+    OutEvent.Bar = InRecord.Bar;
+    OutEvent.Beat = InRecord.Beat;
+    OutEvent.Snapshot.Block = InRecord.AudioBlock;
+    OutEvent.Snapshot.NumSamples = InRecord.AudioBlock.IsValid() ? InRecord.AudioBlock->GetSamples().Num() : 0;
+    OutEvent.Snapshot.SampleRate = InRecord.AudioBlock.IsValid() ? InRecord.AudioBlock->GetSampleRate() : 0.0f;
+    OutEvent.SampleIndex = InRecord.SampleIndex;
+    OutEvent.AudioTime = InRecord.SampleRate > 0.0f ? static_cast<double>(InRecord.SampleIndex) / InRecord.SampleRate : 0.0;
+}
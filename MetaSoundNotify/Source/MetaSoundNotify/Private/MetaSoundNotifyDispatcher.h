@@ -0,0 +1,178 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MetaSoundNotifyClassCache.h"
+#include "MetaSoundNotifyTypes.h"
+#include "MetaSoundNotifyRingBuffer.h"
+#include "MetaSoundNotifyMessage.h"
+
+class UMetaSoundNotifySubsystem;
+
+/**
+ * @name FMetaSoundNotifyAddress
+ * @brief "To Notify" address of an operator, shared with the game thread by reference like a message. The render thread
+ * never resolves it: the game thread looks the object up when a notify is delivered and keeps it until it is gone.
+ */
+class FMetaSoundNotifyAddress : public FRefCountBase
+{
+public:
+    explicit FMetaSoundNotifyAddress(const FString& InText)
+    : Text(InText)
+    {
+    }
+
+    const FString& GetText() const
+    {
+        return Text;
+    }
+
+    /** Object the address points to, null if there is none. Game thread only. A missing object is looked up at most once per frame. */
+    UObject* Resolve() const;
+
+private:
+    const FString Text;
+    mutable FWeakObjectPtr Listener;
+    mutable uint64 LastResolveFrame = MAX_uint64;
+};
+
+/**
+ * @name FMetaSoundNotifyListener
+ * @brief Who a notify goes to. Either a registered listener handle, a listener group, the owner of the audio component
+ * playing the MetaSound, a "To Notify" address resolved on the game thread, or an object.
+ */
+struct FMetaSoundNotifyListener
+{
+    TRefCountPtr<FMetaSoundNotifyAddress> Address;
+    FWeakObjectPtr Object;
+    int32 Handle = 0;
+    FName Group;
+    uint64 OwnerComponentID = 0;
+};
+
+/**
+ * @name FMetaSoundNotifyRecord
+ * @brief Compact notify pushed by the operators on the render thread and delivered on the game thread.
+ */
+struct FMetaSoundNotifyRecord
+{
+    FMetaSoundNotifyListener Listener;
+    EMetaSoundNotifyType Type = EMetaSoundNotifyType::Notify;
+    int32 NotifyID = 0;
+    // Int value, or cue point index for cue point notifies.
+    int32 IntValue = 0;
+    // Float value, time in seconds for time notifies, envelope level for threshold notifies, or onset strength for onset notifies.
+    float FloatValue = 0.0f;
+    bool bBoolValue = false;
+    // Message, or cue point label for cue point notifies. Shared with the sending node, never copied on the render thread.
+    FMetaSoundNotifyMessageRef Message;
+    // Position of the notify in the beat grid, for beat notifies.
+    int32 Bar = 0;
+    int32 Beat = 0;
+    // Window of samples, for audio snapshot notifies. Only a reference, the samples are never copied.
+    TRefCountPtr<FMetaSoundNotifyAudioBlock> AudioBlock;
+    // Sample at which the notify was sent, counted from the start of the MetaSound.
+    int64 SampleIndex = 0;
+    float SampleRate = 0.0f;
+};
+
+/** Delivery order of the notifies when the drain runs out of budget. Cue points go first, value streams last. */
+enum class EMetaSoundNotifyPriority : uint8
+{
+    Cue,
+    Event,
+    Value,
+    Count
+};
+
+/**
+ * @name FMetaSoundNotifyDispatcher
+ * @brief Moves notifies from the MetaSound render thread to the game thread.
+ * Operators only push records into a preallocated ring. The core ticker drains it on the game thread, which is the
+ * only place where listeners get resolved and the interface gets called.
+ * With a budget (au.MetaSoundNotify.DrainBudgetUs) the drain stops delivering when it runs out of time, and what is
+ * left is delivered on the next ticks, highest priority first. Deferred notifies keep their sample timestamps.
+ */
+class FMetaSoundNotifyDispatcher
+{
+public:
+    static FMetaSoundNotifyDispatcher& Get();
+
+    static constexpr uint32 QueueCapacity = 4096;
+
+    void Startup();
+    void Shutdown();
+
+    /**
+     * Safe to call from any thread. Never allocates. Returns false if the queue is full and the notify is dropped.
+     * Queued notifies are captured by the recorder, unless bInRecord is false (replays, so they aren't recorded twice).
+     */
+    bool Enqueue(const FMetaSoundNotifyRecord& InRecord, bool bInRecord = true);
+
+    /**
+     * Delivers pending notifies, all of them without a budget. With one, delivers by priority until the budget is
+     * spent and keeps the rest for the next drain. Game thread only.
+     */
+    void Drain(double InBudgetSeconds = 0.0);
+
+    static EMetaSoundNotifyPriority GetPriority(EMetaSoundNotifyType InType);
+
+    /** Object a handle, owner or object listener points to, null for groups or if it is gone. Game thread only. */
+    static UObject* ResolveTarget(const FMetaSoundNotifyListener& InListener, const UMetaSoundNotifySubsystem* InSubsystem);
+
+private:
+    FMetaSoundNotifyDispatcher();
+
+    bool Tick(float DeltaTime);
+    void DrainBacklog(uint64 InEndCycles);
+    void Deliver(const FMetaSoundNotifyRecord& InRecord);
+    void DeliverTo(UObject* InTarget, const FMetaSoundNotifyRecord& InRecord);
+    void AddToBatch(UObject* InListener, const FMetaSoundNotifyRecord& InRecord);
+    void FlushBatches();
+    static void MakeEvent(const FMetaSoundNotifyRecord& InRecord, FMetaSoundNotifyEvent& OutEvent);
+
+    struct FListenerBatch
+    {
+        TWeakObjectPtr<UObject> Listener;
+        TArray<FMetaSoundNotifyEvent> Events;
+    };
+
+    // Notify waiting for a drain with some budget left, and the drain it was pulled out of the queue in.
+    struct FBacklogNotify
+    {
+        FMetaSoundNotifyRecord Record;
+        uint32 DrainCount = 0;
+    };
+
+    // FIFO of the notifies of one priority. Head is the next one to deliver.
+    struct FBacklog
+    {
+        TArray<FBacklogNotify> Notifies;
+        int32 Head = 0;
+
+        int32 Num() const
+        {
+            return Notifies.Num() - Head;
+        }
+    };
+
+    TMetaSoundNotifyRingBuffer<FMetaSoundNotifyRecord> Queue;
+    FBacklog Backlogs[static_cast<int32>(EMetaSoundNotifyPriority::Count)];
+    uint32 DrainCount = 0;
+    // Scratch record reused by the drain.
+    FMetaSoundNotifyRecord Pending;
+    // Subsystem owning the handles, groups and native listeners, looked up once per drain.
+    UMetaSoundNotifySubsystem* Subsystem = nullptr;
+    // Scratch copy of the group being delivered to, listeners may join or leave groups while we call them.
+    TArray<TWeakObjectPtr<UObject>> GroupMembers;
+    // Scratch payload reused for the generic event.
+    FMetaSoundNotifyEvent ScratchEvent;
+    // Batches of the listeners implementing the batch event. Kept between drains so their arrays are reused.
+    TArray<FListenerBatch> Batches;
+    TMap<UObject*, int32> BatchIndices;
+    int32 NumActiveBatches = 0;
+    std::atomic<uint32> NumDropped{ 0 };
+    FMetaSoundNotifyClassCache ClassCache;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,321 @@
+#include "MetasoundParamHelper.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundAudioBuffer.h"
+#include "DSP/FloatArrayMath.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyEnvelopeNode"
+
+namespace Metasound
+{
+    #pragma region PARAMETERS
+    namespace NotifyEnvelopeNode
+    {
+        METASOUND_PARAM(InParamNameAudio, "In", "Audio to follow.")
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
+        METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
+        METASOUND_PARAM(InParamNameRMS, "RMS", "Follows the RMS level of the audio instead of its peak level.")
+        METASOUND_PARAM(InParamNameAttack, "Attack Time", "Time in seconds the envelope takes to rise towards a louder level.")
+        METASOUND_PARAM(InParamNameRelease, "Release Time", "Time in seconds the envelope takes to fall towards a quieter level.")
+        METASOUND_PARAM(InParamNameOpen, "Open Threshold", "Linear level the envelope has to reach to send a rising notify.")
+        METASOUND_PARAM(InParamNameClose, "Close Threshold", "Linear level the envelope has to fall below to send a falling notify. Clamped to the open threshold.")
+        METASOUND_PARAM(OutParamNameRise, "On Rise", "Triggered when the envelope rises above the open threshold.")
+        METASOUND_PARAM(OutParamNameFall, "On Fall", "Triggered when the envelope falls below the close threshold.")
+        METASOUND_PARAM(OutParamNameEnvelope, "Envelope", "Current envelope level.")
+    }
+    #pragma endregion
+
+    #pragma region OPERATOR
+    class FNotifyEnvelopeOperator : public TExecutableOperator<FNotifyEnvelopeOperator>
+    {
+    public:
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        FNotifyEnvelopeOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
+        const FAudioBufferReadRef& InAudioInput,
+        const FStringReadRef& InAddressInput,
+        const FInt32ReadRef& InListenerHandleInput,
+        const FInt32ReadRef& InIDInput,
+        const FBoolReadRef& InRMSInput,
+        const FFloatReadRef& InAttackInput,
+        const FFloatReadRef& InReleaseInput,
+        const FFloatReadRef& InOpenInput,
+        const FFloatReadRef& InCloseInput);
+
+        virtual FDataReferenceCollection GetInputs()  const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+
+        void Execute();
+
+    private:
+        FAudioBufferReadRef AudioInput;
+        FStringReadRef AddressInput;
+        FInt32ReadRef ListenerHandleInput;
+        FInt32ReadRef IDInput;
+        FBoolReadRef RMSInput;
+        FFloatReadRef AttackInput;
+        FFloatReadRef ReleaseInput;
+        FFloatReadRef OpenInput;
+        FFloatReadRef CloseInput;
+
+        FTriggerWriteRef RiseTrigger;
+        FTriggerWriteRef FallTrigger;
+        FFloatWriteRef EnvelopeOutput;
+
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+
+        // Duration of a block, the envelope moves once per block.
+        float BlockSeconds = 0.0f;
+        float Envelope = 0.0f;
+        bool bOpen = false;
+
+        float GetCoefficient(float InTime) const;
+        int32 GetCrossingFrame(float InPreviousEnvelope, float InThreshold) const;
+        void SendMessageToListener(int32 InFrame, bool bInRising);
+    };
+
+    FNotifyEnvelopeOperator::FNotifyEnvelopeOperator(const FOperatorSettings& InSettings,
+    const FMetasoundEnvironment& InEnvironment,
+    const FAudioBufferReadRef& InAudioInput,
+    const FStringReadRef& InAddressInput,
+    const FInt32ReadRef& InListenerHandleInput,
+    const FInt32ReadRef& InIDInput,
+    const FBoolReadRef& InRMSInput,
+    const FFloatReadRef& InAttackInput,
+    const FFloatReadRef& InReleaseInput,
+    const FFloatReadRef& InOpenInput,
+    const FFloatReadRef& InCloseInput)
+    :
+    AudioInput(InAudioInput),
+    AddressInput(InAddressInput),
+    ListenerHandleInput(InListenerHandleInput),
+    IDInput(InIDInput),
+    RMSInput(InRMSInput),
+    AttackInput(InAttackInput),
+    ReleaseInput(InReleaseInput),
+    OpenInput(InOpenInput),
+    CloseInput(InCloseInput),
+    RiseTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    FallTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    EnvelopeOutput(FFloatWriteRef::CreateNew(0.0f)),
+    ListenerCache(InEnvironment),
+    Clock(InSettings),
+    BlockSeconds(InSettings.GetNumFramesPerBlock() / FMath::Max(InSettings.GetSampleRate(), 1.0f))
+    {
+    }
+
+    FDataReferenceCollection FNotifyEnvelopeOperator::GetInputs() const
+    {
+        using namespace NotifyEnvelopeNode;
+
+        FDataReferenceCollection InputDataReferences;
+
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAudio), AudioInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameRMS), RMSInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAttack), AttackInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameRelease), ReleaseInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameOpen), OpenInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameClose), CloseInput);
+
+        return InputDataReferences;
+    }
+
+    FDataReferenceCollection FNotifyEnvelopeOperator::GetOutputs() const
+    {
+        using namespace NotifyEnvelopeNode;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameRise), RiseTrigger);
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameFall), FallTrigger);
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameEnvelope), EnvelopeOutput);
+
+        return OutputDataReferences;
+    }
+
+    void FNotifyEnvelopeOperator::Execute()
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
+        RiseTrigger->AdvanceBlock();
+        FallTrigger->AdvanceBlock();
+
+        // Block level with the vectorized kernels of SignalProcessing, instead of a per sample follower.
+        const TArrayView<const float> Samples(AudioInput->GetData(), AudioInput->Num());
+        float Level = 0.0f;
+
+        if (*RMSInput)
+        {
+            float MeanSquared = 0.0f;
+            Audio::ArrayMeanSquared(Samples, MeanSquared);
+            Level = FMath::Sqrt(MeanSquared);
+        }
+        else
+        {
+            Level = Audio::ArrayMaxAbsValue(Samples);
+        }
+
+        const float PreviousEnvelope = Envelope;
+        const float Coefficient = GetCoefficient(Level > Envelope ? *AttackInput : *ReleaseInput);
+        Envelope = Level + Coefficient * (Envelope - Level);
+        *EnvelopeOutput = Envelope;
+
+        const float OpenThreshold = *OpenInput;
+        const float CloseThreshold = FMath::Min(*CloseInput, OpenThreshold);
+
+        if (!bOpen && Envelope >= OpenThreshold)
+        {
+            bOpen = true;
+
+            const int32 Frame = GetCrossingFrame(PreviousEnvelope, OpenThreshold);
+            RiseTrigger->TriggerFrame(Frame);
+            SendMessageToListener(Frame, true);
+        }
+        else if (bOpen && Envelope < CloseThreshold)
+        {
+            bOpen = false;
+
+            const int32 Frame = GetCrossingFrame(PreviousEnvelope, CloseThreshold);
+            FallTrigger->TriggerFrame(Frame);
+            SendMessageToListener(Frame, false);
+        }
+
+        Clock.AdvanceBlock();
+    }
+
+    float FNotifyEnvelopeOperator::GetCoefficient(float InTime) const
+    {
+        // One pole smoothing, applied once per block.
+        return InTime > 0.0f ? FMath::Exp(-BlockSeconds / InTime) : 0.0f;
+    }
+
+    int32 FNotifyEnvelopeOperator::GetCrossingFrame(float InPreviousEnvelope, float InThreshold) const
+    {
+        // The envelope is assumed to move linearly across the block.
+        const int32 NumFrames = Clock.GetNumFramesPerBlock();
+        const float Distance = Envelope - InPreviousEnvelope;
+
+        if (FMath::IsNearlyZero(Distance))
+        {
+            return 0;
+        }
+
+        return FMath::Clamp(static_cast<int32>((InThreshold - InPreviousEnvelope) / Distance * NumFrames), 0, NumFrames - 1);
+    }
+
+    const FVertexInterface& FNotifyEnvelopeOperator::GetVertexInterface()
+    {
+        using namespace NotifyEnvelopeNode;
+
+        static const FVertexInterface Interface(
+            FInputVertexInterface(
+                TInputDataVertexModel<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudio)),
+                TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID)),
+                TInputDataVertexModel<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameRMS), false),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAttack), 0.01f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameRelease), 0.1f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameOpen), 0.5f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameClose), 0.4f)
+            ),
+            FOutputVertexInterface(
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameRise)),
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameFall)),
+                TOutputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameEnvelope))
+            )
+        );
+
+        return Interface;
+    }
+
+    const FNodeClassMetadata& FNotifyEnvelopeOperator::GetNodeInfo()
+    {
+        auto InitNodeInfo = []() -> FNodeClassMetadata
+        {
+            FNodeClassMetadata Info;
+
+            Info.ClassName        = { TEXT("UE"), TEXT("NotifyEnvelope"), TEXT("Notify Envelope Threshold") };
+            Info.MajorVersion     = 1;
+            Info.MinorVersion     = 0;
+            Info.DisplayName      = LOCTEXT("Metasound_NotifyEnvelopeDisplayName", "Notify Envelope Threshold");
+            Info.Description      = LOCTEXT("Metasound_NotifyEnvelopeNodeDescription", "Follows the peak or RMS level of the audio and sends a threshold notify (envelope level and direction) when it rises above the open threshold or falls below the close threshold. Threshold notifies are received through the MetaSounds Notify Event and Batch events.");
+            Info.Author           = PluginAuthor;
+            Info.PromptIfMissing  = PluginNodeMissingPrompt;
+            Info.DefaultInterface = GetVertexInterface();
+            Info.CategoryHierarchy = { LOCTEXT("Metasound_NotifyEnvelopeNodeCategory", "Notify") };
+
+            return Info;
+        };
+
+        static const FNodeClassMetadata Info = InitNodeInfo();
+
+        return Info;
+    }
+
+    TUniquePtr<IOperator> FNotifyEnvelopeOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace NotifyEnvelopeNode;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudio), InParams.OperatorSettings);
+        FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
+        FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
+        FBoolReadRef RMSIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<bool>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameRMS), InParams.OperatorSettings);
+        FFloatReadRef AttackIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAttack), InParams.OperatorSettings);
+        FFloatReadRef ReleaseIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameRelease), InParams.OperatorSettings);
+        FFloatReadRef OpenIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameOpen), InParams.OperatorSettings);
+        FFloatReadRef CloseIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameClose), InParams.OperatorSettings);
+
+        return MakeUnique<FNotifyEnvelopeOperator>(InParams.OperatorSettings, InParams.Environment, AudioIn, AddressIn, ListenerHandleIn, IDIn, RMSIn, AttackIn, ReleaseIn, OpenIn, CloseIn);
+    }
+
+    void FNotifyEnvelopeOperator::SendMessageToListener(int32 InFrame, bool bInRising){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
+
+        FMetaSoundNotifyRecord Record;
+
+        if (ListenerCache.Resolve(*AddressInput, *ListenerHandleInput, Record.Listener))
+        {
+            Record.Type = EMetaSoundNotifyType::Threshold;
+            Record.NotifyID = *IDInput;
+            Record.FloatValue = Envelope;
+            Record.bBoolValue = bInRising;
+
+            Clock.Stamp(InFrame, Record);
+
+            FMetaSoundNotifyDispatcher::Get().Enqueue(Record);
+        }
+    }
+    #pragma endregion
+
+    #pragma region NODE
+    class FNotifyEnvelopeNode : public FNodeFacade
+    {
+    public:
+        FNotifyEnvelopeNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FNotifyEnvelopeOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FNotifyEnvelopeNode)
+    #pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
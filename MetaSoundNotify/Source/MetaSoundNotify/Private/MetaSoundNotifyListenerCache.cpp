@@ -0,0 +1,66 @@
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
+
+const FName FMetaSoundNotifyListenerCache::AudioComponentIDName = TEXT("AudioComponentID");
+
+FMetaSoundNotifyListenerCache::FMetaSoundNotifyListenerCache(const Metasound::FMetasoundEnvironment& InEnvironment)
+{
+    if (InEnvironment.Contains<uint64>(AudioComponentIDName))
+    {
+        OwnerComponentID = InEnvironment.GetValue<uint64>(AudioComponentIDName);
+    }
+}
+
+bool FMetaSoundNotifyListenerCache::Resolve(const FString& InAddress, int32 InHandle, FMetaSoundNotifyListener& OutListener)
+{
+    if (InHandle != 0)
+    {
+        OutListener.Handle = InHandle;
+        return true;
+    }
+
+    if (InAddress.IsEmpty())
+    {
+        // No string to parse at all, the owner is looked up from the component on the game thread.
+        if (OwnerComponentID == 0)
+        {
+            INC_DWORD_STAT(STAT_MetaSoundNotifyFailedResolves);
+            return false;
+        }
+
+        OutListener.OwnerComponentID = OwnerComponentID;
+        return true;
+    }
+
+    const int32 Length = InAddress.Len();
+    const uint32 Hash = FCrc::StrCrc32(*InAddress);
+
+    if (Length != AddressLength || Hash != AddressHash)
+    {
+        // Slow path, only taken when the address changes. Nothing is looked up here, the game thread resolves it.
+        AddressLength = Length;
+        AddressHash = Hash;
+        Address.SafeRelease();
+        Group = NAME_None;
+
+        if (InAddress.StartsWith(GroupPrefix, ESearchCase::IgnoreCase))
+        {
+            Group = FName(*InAddress.RightChop(FCString::Strlen(GroupPrefix)));
+        }
+        else
+        {
+            Address = new FMetaSoundNotifyAddress(InAddress);
+        }
+    }
+
+    if (!Group.IsNone())
+    {
+        OutListener.Group = Group;
+    }
+    else
+    {
+        OutListener.Address = Address;
+    }
+
+    return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetasoundEnvironment.h"
+#include "MetaSoundNotifyDispatcher.h"
+
+/**
+ * @name FMetaSoundNotifyListenerCache
+ * @brief Turns the "To Notify" address of an operator into a listener, without looking any object up on the render
+ * thread. The address is only parsed again when its length or hash changes, and is shared with the game thread which
+ * resolves it and keeps the resolved object.
+ * Addresses starting with "group:" target a listener group of the subsystem instead of a single object.
+ * An empty address targets the owner of the audio component playing the MetaSound, taken from the environment once when
+ * the operator is created.
+ */
+class FMetaSoundNotifyListenerCache
+{
+public:
+    explicit FMetaSoundNotifyListenerCache(const Metasound::FMetasoundEnvironment& InEnvironment);
+
+    /** Whether Resolve can find someone to notify with this address and handle, without resolving anything. */
+    bool CanResolve(const FString& InAddress, int32 InHandle) const
+    {
+        return InHandle != 0 || !InAddress.IsEmpty() || OwnerComponentID != 0;
+    }
+
+    /**
+     * Fills OutListener with the listener to notify. A non zero handle from the subsystem wins over the address. Both are
+     * resolved on the game thread. Returns false if there is nobody to notify.
+     */
+    bool Resolve(const FString& InAddress, int32 InHandle, FMetaSoundNotifyListener& OutListener);
+
+    static constexpr const TCHAR* GroupPrefix = TEXT("group:");
+
+    // Environment variable holding the ID of the audio component playing the MetaSound.
+    static const FName AudioComponentIDName;
+
+private:
+    uint64 OwnerComponentID = 0;
+    TRefCountPtr<FMetaSoundNotifyAddress> Address;
+    FName Group;
+    int32 AddressLength = INDEX_NONE;
+    uint32 AddressHash = 0;
+};
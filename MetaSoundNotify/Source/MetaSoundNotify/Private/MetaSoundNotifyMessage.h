@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/RefCounting.h"
+#include <atomic>
+
+/**
+ * @name FMetaSoundNotifyMessage
+ * @brief String payload (message, cue point label) shared by the render thread and the game thread.
+ * Records only carry a reference to it, so sending a string notify never copies the string. The text never changes while
+ * anyone but the message cache that owns it holds a reference.
+ */
+class FMetaSoundNotifyMessage : public FRefCountBase
+{
+public:
+    explicit FMetaSoundNotifyMessage(const FString& InText)
+    : Text(InText)
+    {
+    }
+
+    const FString& GetText() const
+    {
+        return Text;
+    }
+
+    /** Text of a message reference, empty if there is none. */
+    static const FString& GetTextOrEmpty(const TRefCountPtr<FMetaSoundNotifyMessage>& InMessage)
+    {
+        static const FString Empty;
+        return InMessage.IsValid() ? InMessage->Text : Empty;
+    }
+
+private:
+    friend class FMetaSoundNotifyMessageCache;
+
+    // Empty message with room for InLength characters, for the pools of the message caches.
+    explicit FMetaSoundNotifyMessage(int32 InLength)
+    {
+        Text.Reserve(InLength);
+    }
+
+    // Rewrites the text in place. Only allocates if it doesn't fit in the buffer, which then keeps the new size.
+    void Assign(const FString& InText)
+    {
+        Text.Reset();
+        Text.Append(InText);
+    }
+
+    FString Text;
+};
+
+using FMetaSoundNotifyMessageRef = TRefCountPtr<FMetaSoundNotifyMessage>;
+
+/**
+ * @name FMetaSoundNotifyMessageCache
+ * @brief Interns the string input of an operator into a pool of messages allocated with the operator.
+ * Sending the same string again shares the previous message. A new string is written into a message of the pool nobody
+ * else references anymore, so a changing string doesn't allocate on the render thread. Only when every message of the
+ * pool is still waiting to be delivered (or flushed into a recording) is a new one allocated.
+ */
+class FMetaSoundNotifyMessageCache
+{
+public:
+    static constexpr int32 DefaultPoolSize = 4;
+    static constexpr int32 ReservedLength = 128;
+
+    explicit FMetaSoundNotifyMessageCache(int32 InPoolSize = DefaultPoolSize)
+    {
+        Pool.Reserve(InPoolSize);
+        for (int32 Index = 0; Index < InPoolSize; ++Index)
+        {
+            Pool.Add(new FMetaSoundNotifyMessage(ReservedLength));
+        }
+    }
+
+    const FMetaSoundNotifyMessageRef& Intern(const FString& InText)
+    {
+        if (InText.IsEmpty())
+        {
+            Message.SafeRelease();
+        }
+        else if (!Message.IsValid() || !Message->GetText().Equals(InText, ESearchCase::CaseSensitive))
+        {
+            // Slow path, only taken when the string changes.
+            Message = Acquire(InText);
+        }
+
+        return Message;
+    }
+
+private:
+    FMetaSoundNotifyMessageRef Acquire(const FString& InText)
+    {
+        for (const FMetaSoundNotifyMessageRef& Entry : Pool)
+        {
+            // Referenced by the pool, and by Message if it is the current one: nobody else can read it anymore.
+            const uint32 NumOwnRefs = Entry == Message ? 2 : 1;
+
+            if (Entry->GetRefCount() == NumOwnRefs)
+            {
+                // GetRefCount() is a relaxed load. Pairs with the release of the decrement in FRefCountBase::Release(), so
+                // whatever the last other owner read from the text (the game thread delivering it) happens before we
+                // overwrite it.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                Entry->Assign(InText);
+                return Entry;
+            }
+        }
+
+        return new FMetaSoundNotifyMessage(InText);
+    }
+
+    TArray<FMetaSoundNotifyMessageRef, TInlineAllocator<DefaultPoolSize>> Pool;
+    FMetaSoundNotifyMessageRef Message;
+};
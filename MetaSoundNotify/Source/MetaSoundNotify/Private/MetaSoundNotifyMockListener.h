@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaSoundNotifyTypes.h"
+#include "MetaSoundNotifyMockListener.generated.h"
+
+/**
+ * @brief Native listener of the commandlets (benchmarks, offline renders, replays) and of the automation tests, only
+ * counts what it receives. Private to the module. It can't be compiled out of shipping builds like the tests, UHT
+ * generates its reflection code in every configuration.
+ */
+UCLASS(Transient, NotBlueprintable, NotBlueprintType)
+class UMetaSoundNotifyMockListener : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void OnNotify(const FMetaSoundNotifyEvent& Event)
+    {
+        ++NumReceived;
+    }
+
+    int64 NumReceived = 0;
+};
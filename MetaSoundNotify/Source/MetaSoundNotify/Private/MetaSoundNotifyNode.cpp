@@ -1,256 +1,191 @@
-#include "MetasoundParamHelper.h"
-#include "MetasoundEnumRegistrationMacro.h"
-#include "MetaSoundNotifyInterface.h"
+#include "MetaSoundNotifyOperator.h"
+#include "MetasoundTime.h"
 
 // Define a localized namespace for the node!
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyNode"
 
+// Every simple notify node (Send trigger, listener and an optional value) is the same TNotifyOperator, declared in
+// MetaSoundNotifyOperator.h. Only its payload traits change.
+// Want a node for a new type? Specialize TNotifyPayloadTraits for it below and register TNotifyNode<YourType>. Done!
+// For nodes with their own behavior, take a look at MetaSoundNotifyBeatGridNode.cpp instead.
 namespace Metasound
 {
-    // Specify your parameter names and descriptions here.
-    #pragma region PARAMETERS
-    // Create your own namespace for the node!
-    namespace NotifyNode
-    {
-        // Every parameter must start with a fixed naming convention! InParamName for inputs and OutParamName for outputs! I.e.:
-        // METASOUND_PARAM(InParamNameMyInput, "Name to display in the graph.", "Description to display in the graph.")
-        // METASOUND_PARAM(OutParamNameMyOutput, "Name to display in the graph.", "Description to display in the graph.")
-        
-        // Inputs
-        METASOUND_PARAM(InParamNameSend, "Send", "Sends the notify.")
-        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string.")
-        METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
-        // Outputs
-        METASOUND_PARAM(OutParamNameSent, "On Sent", "Triggered after we send the notify.")
-    }
-    #pragma endregion
-    
-    // Create your operator and main behavior here.
-    #pragma region OPERATOR
-    /** 
-     * @name FNotifyOperator Declaration
-     * @brief Declare your node operator class here. It must start with F and end with Operator!
+    #pragma region PAYLOADS
+    /**
+     * @brief Notify, no payload.
     */
-    class FNotifyOperator : public TExecutableOperator<FNotifyOperator>
+    template<>
+    struct TNotifyPayloadTraits<void> : FNotifyPayloadTraitsBase
     {
-    public:
-        static const FNodeClassMetadata& GetNodeInfo();
-        static const FVertexInterface& GetVertexInterface();
-        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
-
-        // Declare every input you want for your node in this constructor.
-        FNotifyOperator(const FOperatorSettings& InSettings,
-        const FTriggerReadRef& InSend,
-        const FStringReadRef& InAddressInput,
-        const FInt32ReadRef& InID);
-
-        // Override GetInputs & GetOutputs
-        virtual FDataReferenceCollection GetInputs()  const override;
-        virtual FDataReferenceCollection GetOutputs() const override;
-
-        // Function that will execute the node behavior.
-        void Execute();
-
-    private:
-        // Declare any input parameters you want. For internal use only.
-        FTriggerReadRef SendTrigger;
-        FStringReadRef AddressInput;
-        FInt32ReadRef IDInput;
-        
-        // Declare any output parameters you want. For internal use only.
-        FTriggerWriteRef SentTrigger;
-
-        // Custom function for this specific node
-        void SendMessageToListener();
+        static constexpr EMetaSoundNotifyType Type = EMetaSoundNotifyType::Notify;
+        static constexpr int32 MinorVersion = 1;
+        static constexpr bool bCanWatch = false;
+        static constexpr bool bHasEpsilon = false;
+
+        static FNodeClassName GetClassName() { return { TEXT("UE"), TEXT("Notify"), TEXT("Notify") }; }
+        static FText GetDisplayName() { return LOCTEXT("Metasound_NotifyDisplayName", "Notify"); }
+        static FText GetDescription() { return LOCTEXT("Metasound_NotifyNodeDescription", "Sends a notify to the string address if it implements the NodeInterface (only once per call)."); }
     };
 
     /**
-     * @name FNotifyOperator Implementation
-     * @brief Set every input parameter to its constructor partner and create any outputs you have. Don't forget the ,!
+     * @brief Notify String, the message is the payload.
     */
-    FNotifyOperator::FNotifyOperator(const FOperatorSettings& InSettings,
-    const FTriggerReadRef& InSend,
-    const FStringReadRef& InAddressInput,
-    const FInt32ReadRef& InIDInput
-    )
-    :
-    // Set inputs
-    SendTrigger(InSend),
-    AddressInput(InAddressInput),
-    IDInput(InIDInput),
-    // Create the output
-    SentTrigger(FTriggerWriteRef::CreateNew(InSettings))
+    template<>
+    struct TNotifyPayloadTraits<FString> : FNotifyPayloadTraitsBase
     {
-    }
+        static constexpr EMetaSoundNotifyType Type = EMetaSoundNotifyType::String;
+        static constexpr int32 MinorVersion = 1;
+        static constexpr bool bCanWatch = false;
+        static constexpr bool bHasEpsilon = false;
 
-    /** 
-     * @brief Specify the inputs in this function.
-     * @warning This is obligatory to have! If we don't want any inputs (weird), just don't add any reference to the input collection.
-    */
-    FDataReferenceCollection FNotifyOperator::GetInputs() const
-    {
-        using namespace NotifyNode;
+        static FNodeClassName GetClassName() { return { TEXT("UE"), TEXT("NotifyString"), TEXT("NotifyString") }; }
+        static FText GetDisplayName() { return LOCTEXT("Metasound_NotifyStringDisplayName", "Notify String"); }
+        static FText GetDescription() { return LOCTEXT("Metasound_NotifyStringNodeDescription", "Sends a notify to the string address if it implements the NodeInterface (only once per call). Optional message parameter."); }
 
-        FDataReferenceCollection InputDataReferences;
+        static FVertexName GetValueName() { return TEXT("Message"); }
+        static FDataVertexMetadata GetValueMetadata() { return { LOCTEXT("Metasound_NotifyStringValueTooltip", "Message to notify."), LOCTEXT("Metasound_NotifyStringValueName", "Message") }; }
 
-        // Create a data reference por each input, never forget ; at the end!
-        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameSend), SendTrigger);
-        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
-        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
+        // Interns the message, so sending the same message again doesn't copy it.
+        using FState = FMetaSoundNotifyMessageCache;
 
-        return InputDataReferences;
-    }
+        static void Write(const FString& InValue, FState& InOutState, FMetaSoundNotifyRecord& OutRecord)
+        {
+            OutRecord.Message = InOutState.Intern(InValue);
+        }
+    };
 
     /**
-     * @brief Specify your outputs here.
-     * @warning This is obligatory to have! If we don't want any output, just don't add any reference to the output collection.
-     */
-    FDataReferenceCollection FNotifyOperator::GetOutputs() const
+     * @brief Notify Int.
+    */
+    template<>
+    struct TNotifyPayloadTraits<int32> : FNotifyPayloadTraitsBase
     {
-        using namespace NotifyNode;
+        static constexpr EMetaSoundNotifyType Type = EMetaSoundNotifyType::Int;
+        static constexpr int32 MinorVersion = 2;
+        static constexpr bool bCanWatch = true;
+        static constexpr bool bHasEpsilon = false;
 
-        FDataReferenceCollection OutputDataReferences;
+        static FNodeClassName GetClassName() { return { TEXT("UE"), TEXT("NotifyInt"), TEXT("NotifyInt") }; }
+        static FText GetDisplayName() { return LOCTEXT("Metasound_NotifyIntDisplayName", "Notify Int"); }
+        static FText GetDescription() { return LOCTEXT("Metasound_NotifyIntNodeDescription", "Sends a notify to the string address if it implements the NodeInterface (only once per call). Optional int parameter."); }
 
-        // Create a data reference por each output, never forget ; at the end!
-        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameSent), SentTrigger);
+        static FVertexName GetValueName() { return TEXT("Value"); }
+        static FDataVertexMetadata GetValueMetadata() { return { LOCTEXT("Metasound_NotifyIntValueTooltip", "Int to notify."), LOCTEXT("Metasound_NotifyIntValueName", "Value") }; }
 
-        return OutputDataReferences;
-    }
+        static void Write(int32 InValue, FState& InOutState, FMetaSoundNotifyRecord& OutRecord)
+        {
+            OutRecord.IntValue = InValue;
+        }
+
+        static bool HasChanged(int32 InValue, int32 InLastValue, float InEpsilon)
+        {
+            return InValue != InLastValue;
+        }
+    };
 
     /**
-     * @brief Main executor function! Place your node logic here.
-     * @warning Important information about triggers inside.
+     * @brief Notify Float.
     */
-    void FNotifyOperator::Execute()
+    template<>
+    struct TNotifyPayloadTraits<float> : FNotifyPayloadTraitsBase
     {
-		// For every trigger output we have, we need to advance its block! This is OBLIGATORY if we want the output triggers to work.
-        // I did not test if we need to do the same with non-trigger outputs, be cautious and test yourself.
-        SentTrigger->AdvanceBlock();
-        
-        // This is the function that will execute once we call our input trigger.
-        SendTrigger->ExecuteBlock(
-			[](int32, int32)
-			{
-			},
-			[this](int32 StartFrame, int32 EndFrame)
-			{
-                // Place your logic inside here!
+        static constexpr EMetaSoundNotifyType Type = EMetaSoundNotifyType::Float;
+        static constexpr int32 MinorVersion = 2;
+        static constexpr bool bCanWatch = true;
+        static constexpr bool bHasEpsilon = true;
 
-                // Call custom function to execute message.             
-                SendMessageToListener();
-                // Execute the output trigger.
-                SentTrigger->TriggerFrame(StartFrame);
-			}
-		);
-    }
+        static FNodeClassName GetClassName() { return { TEXT("UE"), TEXT("NotifyFloat"), TEXT("NotifyFloat") }; }
+        static FText GetDisplayName() { return LOCTEXT("Metasound_NotifyFloatDisplayName", "Notify Float"); }
+        static FText GetDescription() { return LOCTEXT("Metasound_NotifyFloatNodeDescription", "Sends a notify to the string address if it implements the NodeInterface (only once per call). Optional float parameter."); }
 
-    /**
-     * @brief Here, you will specify the interface for the node. Don't forget to do inputs and outputs!
-    */
-    const FVertexInterface& FNotifyOperator::GetVertexInterface()
-    {
-        using namespace NotifyNode;
+        static FVertexName GetValueName() { return TEXT("Value"); }
+        static FDataVertexMetadata GetValueMetadata() { return { LOCTEXT("Metasound_NotifyFloatValueTooltip", "Float to notify."), LOCTEXT("Metasound_NotifyFloatValueName", "Value") }; }
 
-        // Create the interface and fill it.
-        static const FVertexInterface Interface(
-            // Create an FInputVertexInterface and fill it with your inputs. Specify the correct data type for every parameter!
-            // Do NOT forget comas!
-            FInputVertexInterface(
-                TInputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameSend)),
-                TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
-                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID))
-            ),
-            
-            // Create an FOutputVertexInterface and fill it with your outputs. Specify the correct data type for every parameter!
-            // Do NOT forget comas!
-            FOutputVertexInterface(
-                // You can leave this empty if you don't have any outputs.
-                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameSent))
-            )
-        );
+        static void Write(float InValue, FState& InOutState, FMetaSoundNotifyRecord& OutRecord)
+        {
+            OutRecord.FloatValue = InValue;
+        }
 
-        return Interface;
-    }
+        static bool HasChanged(float InValue, float InLastValue, float InEpsilon)
+        {
+            return FMath::Abs(InValue - InLastValue) > InEpsilon;
+        }
+    };
 
     /**
-     * @brief Edit your node info here!
+     * @brief Notify Bool.
     */
-    const FNodeClassMetadata& FNotifyOperator::GetNodeInfo()
+    template<>
+    struct TNotifyPayloadTraits<bool> : FNotifyPayloadTraitsBase
     {
-        auto InitNodeInfo = []() -> FNodeClassMetadata
-        {
-            FNodeClassMetadata Info;
+        static constexpr EMetaSoundNotifyType Type = EMetaSoundNotifyType::Bool;
+        static constexpr int32 MinorVersion = 2;
+        static constexpr bool bCanWatch = true;
+        static constexpr bool bHasEpsilon = false;
 
-            Info.ClassName        = { TEXT("UE"), TEXT("Notify"), TEXT("Notify") };
-            Info.MajorVersion     = 1;
-            Info.MinorVersion     = 0;
-            Info.DisplayName      = LOCTEXT("Metasound_NotifyDisplayName", "Notify");
-            Info.Description      = LOCTEXT("Metasound_NotifyNodeDescription", "Sends a notify to the string address if it implements the NodeInterface (only once per call).");
-            Info.Author           = PluginAuthor;
-            Info.PromptIfMissing  = PluginNodeMissingPrompt;
-            Info.DefaultInterface = GetVertexInterface();
-            Info.CategoryHierarchy = { LOCTEXT("Metasound_NotifyNodeCategory", "Notify") };
+        static FNodeClassName GetClassName() { return { TEXT("UE"), TEXT("NotifyBool"), TEXT("NotifyBool") }; }
+        static FText GetDisplayName() { return LOCTEXT("Metasound_NotifyBoolDisplayName", "Notify Bool"); }
+        static FText GetDescription() { return LOCTEXT("Metasound_NotifyBoolNodeDescription", "Sends a notify to the string address if it implements the NodeInterface (only once per call). Optional Bool parameter."); }
 
-            return Info;
-        };
+        static FVertexName GetValueName() { return TEXT("Value"); }
+        static FDataVertexMetadata GetValueMetadata() { return { LOCTEXT("Metasound_NotifyBoolValueTooltip", "Bool to notify."), LOCTEXT("Metasound_NotifyBoolValueName", "Value") }; }
 
-        static const FNodeClassMetadata Info = InitNodeInfo();
+        static void Write(bool bInValue, FState& InOutState, FMetaSoundNotifyRecord& OutRecord)
+        {
+            OutRecord.bBoolValue = bInValue;
+        }
 
-        return Info;
-    }
+        static bool HasChanged(bool bInValue, bool bInLastValue, float InEpsilon)
+        {
+            return bInValue != bInLastValue;
+        }
+    };
 
     /**
-     * @brief Once again, specify your inputs here. Follow the function structure.
+     * @brief Notify Time, sent in seconds.
     */
-    TUniquePtr<IOperator> FNotifyOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    template<>
+    struct TNotifyPayloadTraits<FTime> : FNotifyPayloadTraitsBase
     {
-        using namespace NotifyNode;
+        static constexpr EMetaSoundNotifyType Type = EMetaSoundNotifyType::Time;
+        static constexpr int32 MinorVersion = 0;
+        static constexpr bool bCanWatch = true;
+        static constexpr bool bHasEpsilon = true;
 
-        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
-        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
-        
-        FTriggerReadRef SendTrigger = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamNameSend), InParams.OperatorSettings);
-        FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
-        FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
+        static FNodeClassName GetClassName() { return { TEXT("UE"), TEXT("NotifyTime"), TEXT("NotifyTime") }; }
+        static FText GetDisplayName() { return LOCTEXT("Metasound_NotifyTimeDisplayName", "Notify Time"); }
+        static FText GetDescription() { return LOCTEXT("Metasound_NotifyTimeNodeDescription", "Sends a notify with a time, in seconds. Received through the MetaSounds Notify Event and Batch events."); }
 
-        return MakeUnique<FNotifyOperator>(InParams.OperatorSettings, SendTrigger, AddressIn, IDIn);
-    }
+        static FVertexName GetValueName() { return TEXT("Value"); }
+        static FDataVertexMetadata GetValueMetadata() { return { LOCTEXT("Metasound_NotifyTimeValueTooltip", "Time to notify."), LOCTEXT("Metasound_NotifyTimeValueName", "Value") }; }
 
-    /**
-     * @brief Function to send the interface message.
-    */
-    void FNotifyOperator::SendMessageToListener(){
-        // Try to convert string into object reference
-        FSoftObjectPath SoftTarget(*AddressInput);
-        TSoftObjectPtr<UObject> SoftTargetPtr(SoftTarget);
-        UObject* Target = SoftTargetPtr.Get();
+        static void Write(const FTime& InValue, FState& InOutState, FMetaSoundNotifyRecord& OutRecord)
+        {
+            OutRecord.FloatValue = static_cast<float>(InValue.GetSeconds());
+        }
 
-        // If object reference is valid and implements the NotifyInterface, execute interface call and disable TriggerIng.
-        if (Target && Target->GetClass()->ImplementsInterface(UMetaSoundNotifyInterface::StaticClass()))
+        static bool HasChanged(const FTime& InValue, const FTime& InLastValue, float InEpsilon)
         {
-            IMetaSoundNotifyInterface::Execute_MetaSoundsNotify(Target, *IDInput);
+            return FMath::Abs(InValue.GetSeconds() - InLastValue.GetSeconds()) > InEpsilon;
         }
-    }
+    };
     #pragma endregion
-    
-    // Create your node class here
+
+    // Register the nodes with MetaSounds.
     #pragma region NODE
-    /** 
-     * @name FNotifyNode class.
-     * @brief Use your custom class name. You can leave everything else untouched.
-    */
-    class FNotifyNode : public FNodeFacade
-    {
-    public:
-        // Constructor used by the Metasound Frontend.
-        FNotifyNode(const FNodeInitData& InitData)
-        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FNotifyOperator>())
-        { 
-        }
-    };
-    
-    // Register the node with MetaSounds
+    using FNotifyNode = TNotifyNode<void>;
+    using FNotifyStringNode = TNotifyNode<FString>;
+    using FNotifyIntNode = TNotifyNode<int32>;
+    using FNotifyFloatNode = TNotifyNode<float>;
+    using FNotifyBoolNode = TNotifyNode<bool>;
+    using FNotifyTimeNode = TNotifyNode<FTime>;
+
     METASOUND_REGISTER_NODE(FNotifyNode)
+    METASOUND_REGISTER_NODE(FNotifyStringNode)
+    METASOUND_REGISTER_NODE(FNotifyIntNode)
+    METASOUND_REGISTER_NODE(FNotifyFloatNode)
+    METASOUND_REGISTER_NODE(FNotifyBoolNode)
+    METASOUND_REGISTER_NODE(FNotifyTimeNode)
     #pragma endregion
 }
 
@@ -0,0 +1,188 @@
+#include "MetaSoundNotifyOfflineRenderCommandlet.h"
+#include "MetaSoundNotify.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyMockListener.h"
+#include "MetaSoundNotifyOperatorHarness.h"
+#include "MetaSoundNotifySubsystem.h"
+#include "MetasoundSource.h"
+#include "Misc/FileHelper.h"
+
+namespace MetaSoundNotifyOfflineRender
+{
+    // One line per notify, only made of values that don't depend on the machine, so two renders can be diffed.
+    FString FormatEvent(const FMetaSoundNotifyEvent& Event)
+    {
+        return FString::Printf(TEXT("%lld\t%.6f\t%s\tid=%d\tint=%d\tfloat=%.6g\tbool=%d\tbar=%d\tbeat=%d\tsamples=%d\tmessage=\"%s\""),
+            Event.SampleIndex,
+            Event.AudioTime,
+            *StaticEnum<EMetaSoundNotifyType>()->GetNameStringByValue(static_cast<int64>(Event.Type)),
+            Event.NotifyID,
+            Event.IntValue,
+            Event.FloatValue,
+            Event.bBoolValue ? 1 : 0,
+            Event.Bar,
+            Event.Beat,
+            Event.Snapshot.NumSamples,
+            *Event.Message.ReplaceCharWithEscapedChar());
+    }
+}
+
+UMetaSoundNotifyOfflineRenderCommandlet::UMetaSoundNotifyOfflineRenderCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UMetaSoundNotifyOfflineRenderCommandlet::Main(const FString& Params)
+{
+    using namespace MetaSoundNotifyOfflineRender;
+
+    FString MetaSoundPath;
+    FString OutputPath;
+    FString GoldenPath;
+    FString Groups;
+    FString HandleInput;
+    FString OnPlayInput = TEXT("UE.Source.OnPlay");
+    float Seconds = 60.0f;
+    float SampleRate = 48000.0f;
+    int32 BlockSize = 256;
+
+    if (!FParse::Value(*Params, TEXT("MetaSound="), MetaSoundPath) || !FParse::Value(*Params, TEXT("Output="), OutputPath))
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Usage: -run=MetaSoundNotifyOfflineRender -MetaSound=<MetaSound Source path> -Output=<file> [-Golden=<file>] [-Seconds=60] [-SampleRate=48000] [-BlockSize=256] [-Groups=<Group>,<Group>] [-HandleInput=<int32 input name>]"));
+        return 1;
+    }
+
+    FParse::Value(*Params, TEXT("Golden="), GoldenPath);
+    FParse::Value(*Params, TEXT("Groups="), Groups, false);
+    FParse::Value(*Params, TEXT("HandleInput="), HandleInput);
+    FParse::Value(*Params, TEXT("OnPlayInput="), OnPlayInput);
+    FParse::Value(*Params, TEXT("Seconds="), Seconds);
+    FParse::Value(*Params, TEXT("SampleRate="), SampleRate);
+    FParse::Value(*Params, TEXT("BlockSize="), BlockSize);
+
+    BlockSize = FMath::Max(BlockSize, 16);
+
+    UMetaSoundNotifySubsystem* Subsystem = UMetaSoundNotifySubsystem::Get();
+    if (!Subsystem)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("The MetaSound Notify subsystem isn't available."));
+        return 1;
+    }
+
+    UMetaSoundSource* MetaSound = LoadObject<UMetaSoundSource>(nullptr, *MetaSoundPath);
+    if (!MetaSound)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't load the MetaSound Source %s."), *MetaSoundPath);
+        return 1;
+    }
+
+    MetaSound->RegisterGraphWithFrontend();
+    const FMetasoundAssetBase::FRuntimeData& RuntimeData = MetaSound->GetRuntimeData();
+    if (!RuntimeData.Graph.IsValid())
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("%s has no graph to render."), *MetaSoundPath);
+        return 1;
+    }
+
+    // Mock listener, every notify it receives becomes a line of the output.
+    TArray<FString> Lines;
+
+    UMetaSoundNotifyMockListener* Listener = NewObject<UMetaSoundNotifyMockListener>();
+    Listener->AddToRoot();
+
+    const int32 Handle = Subsystem->RegisterListener(Listener);
+    Subsystem->AddNativeListener(Listener, INDEX_NONE, FMetaSoundNotifyNativeDelegate::CreateLambda([&Lines](const FMetaSoundNotifyEvent& Event)
+    {
+        Lines.Add(FormatEvent(Event));
+    }));
+
+    TArray<FString> GroupNames;
+    Groups.ParseIntoArray(GroupNames, TEXT(","));
+    for (const FString& GroupName : GroupNames)
+    {
+        Subsystem->JoinGroup(FName(*GroupName.TrimStartAndEnd()), Listener);
+    }
+
+    const Metasound::FOperatorSettings Settings(SampleRate, SampleRate / BlockSize);
+    FMetaSoundNotifyOperatorHarness Harness(Settings);
+
+    Metasound::FTriggerWriteRef OnPlay = Harness.AddTrigger(*OnPlayInput);
+    if (!HandleInput.IsEmpty())
+    {
+        Harness.AddInput<int32>(*HandleInput, Handle);
+    }
+
+    int32 Result = 0;
+
+    if (Harness.CreateGraphOperator(*RuntimeData.Graph))
+    {
+        FMetaSoundNotifyDispatcher& Dispatcher = FMetaSoundNotifyDispatcher::Get();
+        const int64 NumBlocks = FMath::CeilToInt64(FMath::Max(Seconds, 0.0f) * SampleRate / BlockSize);
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        OnPlay->TriggerFrame(0);
+
+        for (int64 Block = 0; Block < NumBlocks; ++Block)
+        {
+            Harness.Execute();
+
+            // Drained on every block, a whole song rendered at once would not fit in the queue.
+            Dispatcher.Drain();
+        }
+
+        const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Rendered %.1f s of %s in %.3f s (%.0fx real time), %d notifies."),
+            NumBlocks * BlockSize / SampleRate, *MetaSoundPath, ElapsedSeconds, ElapsedSeconds > 0.0 ? NumBlocks * BlockSize / SampleRate / ElapsedSeconds : 0.0, Lines.Num());
+
+        if (!FFileHelper::SaveStringArrayToFile(Lines, *OutputPath))
+        {
+            UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't write %s."), *OutputPath);
+            Result = 1;
+        }
+
+        if (!GoldenPath.IsEmpty())
+        {
+            TArray<FString> GoldenLines;
+            if (!FFileHelper::LoadFileToStringArray(GoldenLines, *GoldenPath))
+            {
+                UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't read the golden file %s."), *GoldenPath);
+                Result = 1;
+            }
+            else if (GoldenLines != Lines)
+            {
+                int32 LineIndex = 0;
+                while (LineIndex < Lines.Num() && LineIndex < GoldenLines.Num() && Lines[LineIndex] == GoldenLines[LineIndex])
+                {
+                    ++LineIndex;
+                }
+
+                UE_LOG(LogMetaSoundNotify, Error, TEXT("Notifies differ from %s at line %d:\n  golden: %s\n  render: %s"), *GoldenPath, LineIndex + 1,
+                    GoldenLines.IsValidIndex(LineIndex) ? *GoldenLines[LineIndex] : TEXT("<end of file>"),
+                    Lines.IsValidIndex(LineIndex) ? *Lines[LineIndex] : TEXT("<end of file>"));
+                Result = 1;
+            }
+            else
+            {
+                UE_LOG(LogMetaSoundNotify, Display, TEXT("Notifies match %s."), *GoldenPath);
+            }
+        }
+    }
+    else
+    {
+        Result = 1;
+    }
+
+    for (const FString& GroupName : GroupNames)
+    {
+        Subsystem->LeaveGroup(FName(*GroupName.TrimStartAndEnd()), Listener);
+    }
+
+    Subsystem->RemoveNativeListeners(Listener);
+    Subsystem->UnregisterListener(Handle);
+    Listener->RemoveFromRoot();
+
+    return Result;
+}
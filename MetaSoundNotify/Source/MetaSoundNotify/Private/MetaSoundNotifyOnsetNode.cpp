@@ -0,0 +1,338 @@
+#include "MetasoundParamHelper.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundAudioBuffer.h"
+#include "DSP/AlignedBuffer.h"
+#include "DSP/FFTAlgorithm.h"
+#include "DSP/FloatArrayMath.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyOnsetNode"
+
+namespace Metasound
+{
+    #pragma region PARAMETERS
+    namespace NotifyOnsetNode
+    {
+        METASOUND_PARAM(InParamNameAudio, "In", "Audio to detect onsets in.")
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
+        METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
+        METASOUND_PARAM(InParamNameThreshold, "Threshold", "How many times louder than its recent average the spectral flux has to be to count as an onset. Lower values detect more onsets.")
+        METASOUND_PARAM(InParamNameMinInterval, "Min Interval", "Minimum time in seconds between two onsets.")
+        METASOUND_PARAM(OutParamNameOnset, "On Onset", "Triggered when an onset is detected.")
+    }
+    #pragma endregion
+
+    #pragma region OPERATOR
+    class FNotifyOnsetOperator : public TExecutableOperator<FNotifyOnsetOperator>
+    {
+    public:
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        FNotifyOnsetOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
+        const FAudioBufferReadRef& InAudioInput,
+        const FStringReadRef& InAddressInput,
+        const FInt32ReadRef& InListenerHandleInput,
+        const FInt32ReadRef& InIDInput,
+        const FFloatReadRef& InThresholdInput,
+        const FFloatReadRef& InMinIntervalInput);
+
+        virtual FDataReferenceCollection GetInputs()  const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+
+        void Execute();
+
+    private:
+        FAudioBufferReadRef AudioInput;
+        FStringReadRef AddressInput;
+        FInt32ReadRef ListenerHandleInput;
+        FInt32ReadRef IDInput;
+        FFloatReadRef ThresholdInput;
+        FFloatReadRef MinIntervalInput;
+
+        FTriggerWriteRef OnsetTrigger;
+
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+
+        // 1024 samples window analyzed every 256 samples (about 5ms at 48kHz).
+        static constexpr int32 Log2FFTSize = 10;
+        static constexpr int32 FFTSize = 1 << Log2FFTSize;
+        static constexpr int32 HopSize = FFTSize / 4;
+        static constexpr int32 NumBins = FFTSize / 2 + 1;
+        // Time constant in seconds of the average the flux is compared against.
+        static constexpr float AverageTime = 0.5f;
+        // Flux below this never counts as an onset, keeps silence from triggering.
+        static constexpr float MinFlux = 1.0e-4f;
+
+        // Everything is allocated once, when the operator is created.
+        TUniquePtr<Audio::IFFTAlgorithm> FFT;
+        Audio::FAlignedFloatBuffer AnalysisBuffer;
+        Audio::FAlignedFloatBuffer WindowedBuffer;
+        Audio::FAlignedFloatBuffer Window;
+        Audio::FAlignedFloatBuffer Spectrum;
+        TArray<float> PreviousMagnitudes;
+
+        // New samples written at the end of the analysis buffer since the last hop.
+        int32 NumHopSamples = 0;
+        float AverageCoefficient = 0.0f;
+        float AverageFlux = 0.0f;
+        bool bAboveThreshold = false;
+        int64 LastOnsetSample = TNumericLimits<int64>::Min() / 2;
+
+        void AnalyzeHop(int32 InEndFrame);
+        void SendMessageToListener(int32 InFrame, float InStrength);
+    };
+
+    FNotifyOnsetOperator::FNotifyOnsetOperator(const FOperatorSettings& InSettings,
+    const FMetasoundEnvironment& InEnvironment,
+    const FAudioBufferReadRef& InAudioInput,
+    const FStringReadRef& InAddressInput,
+    const FInt32ReadRef& InListenerHandleInput,
+    const FInt32ReadRef& InIDInput,
+    const FFloatReadRef& InThresholdInput,
+    const FFloatReadRef& InMinIntervalInput)
+    :
+    AudioInput(InAudioInput),
+    AddressInput(InAddressInput),
+    ListenerHandleInput(InListenerHandleInput),
+    IDInput(InIDInput),
+    ThresholdInput(InThresholdInput),
+    MinIntervalInput(InMinIntervalInput),
+    OnsetTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    ListenerCache(InEnvironment),
+    Clock(InSettings)
+    {
+        Audio::FFFTSettings FFTSettings;
+        FFTSettings.Log2Size = Log2FFTSize;
+        FFTSettings.bArrays128BitAligned = true;
+        FFTSettings.bEnableHardwareAcceleration = true;
+
+        FFT = Audio::FFFTFactory::NewFFTAlgorithm(FFTSettings);
+
+        AnalysisBuffer.SetNumZeroed(FFTSize);
+        WindowedBuffer.SetNumZeroed(FFTSize);
+        Window.SetNumUninitialized(FFTSize);
+        Spectrum.SetNumZeroed(FFT.IsValid() ? FFT->NumOutputFloats() : NumBins * 2);
+        PreviousMagnitudes.SetNumZeroed(NumBins);
+
+        // Periodic Hann window.
+        for (int32 Index = 0; Index < FFTSize; ++Index)
+        {
+            Window[Index] = 0.5f - 0.5f * FMath::Cos(2.0f * PI * Index / FFTSize);
+        }
+
+        const float HopSeconds = HopSize / FMath::Max(InSettings.GetSampleRate(), 1.0f);
+        AverageCoefficient = 1.0f - FMath::Exp(-HopSeconds / AverageTime);
+    }
+
+    FDataReferenceCollection FNotifyOnsetOperator::GetInputs() const
+    {
+        using namespace NotifyOnsetNode;
+
+        FDataReferenceCollection InputDataReferences;
+
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAudio), AudioInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameThreshold), ThresholdInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameMinInterval), MinIntervalInput);
+
+        return InputDataReferences;
+    }
+
+    FDataReferenceCollection FNotifyOnsetOperator::GetOutputs() const
+    {
+        using namespace NotifyOnsetNode;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameOnset), OnsetTrigger);
+
+        return OutputDataReferences;
+    }
+
+    void FNotifyOnsetOperator::Execute()
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
+        OnsetTrigger->AdvanceBlock();
+
+        if (FFT.IsValid())
+        {
+            const float* Samples = AudioInput->GetData();
+            const int32 NumFrames = AudioInput->Num();
+            int32 Frame = 0;
+
+            // Fill the end of the analysis buffer hop by hop, the block size doesn't need to match the hop size.
+            while (Frame < NumFrames)
+            {
+                const int32 NumToCopy = FMath::Min(NumFrames - Frame, HopSize - NumHopSamples);
+
+                FMemory::Memcpy(&AnalysisBuffer[FFTSize - HopSize + NumHopSamples], &Samples[Frame], NumToCopy * sizeof(float));
+                NumHopSamples += NumToCopy;
+                Frame += NumToCopy;
+
+                if (NumHopSamples == HopSize)
+                {
+                    AnalyzeHop(Frame);
+
+                    // Slide the overlap down in place to make room for the next hop.
+                    FMemory::Memmove(AnalysisBuffer.GetData(), &AnalysisBuffer[HopSize], (FFTSize - HopSize) * sizeof(float));
+                    NumHopSamples = 0;
+                }
+            }
+        }
+
+        Clock.AdvanceBlock();
+    }
+
+    void FNotifyOnsetOperator::AnalyzeHop(int32 InEndFrame)
+    {
+        FMemory::Memcpy(WindowedBuffer.GetData(), AnalysisBuffer.GetData(), FFTSize * sizeof(float));
+        Audio::ArrayMultiplyInPlace(Window, WindowedBuffer);
+
+        FFT->ForwardRealToComplex(WindowedBuffer.GetData(), Spectrum.GetData());
+
+        // Spectral flux: how much the magnitude of every bin grew since the previous hop.
+        float Flux = 0.0f;
+        for (int32 Bin = 0; Bin < NumBins; ++Bin)
+        {
+            const float Real = Spectrum[2 * Bin];
+            const float Imaginary = Spectrum[2 * Bin + 1];
+            const float Magnitude = FMath::Sqrt(Real * Real + Imaginary * Imaginary);
+
+            Flux += FMath::Max(Magnitude - PreviousMagnitudes[Bin], 0.0f);
+            PreviousMagnitudes[Bin] = Magnitude;
+        }
+        Flux /= NumBins;
+
+        // Adaptive threshold, so the same settings work for quiet and loud tracks.
+        const float Threshold = FMath::Max(AverageFlux * FMath::Max(*ThresholdInput, 1.0f), MinFlux);
+        const bool bWasAboveThreshold = bAboveThreshold;
+        bAboveThreshold = Flux > Threshold;
+        AverageFlux += AverageCoefficient * (Flux - AverageFlux);
+
+        if (!bAboveThreshold || bWasAboveThreshold)
+        {
+            return;
+        }
+
+        const int64 EndSample = Clock.GetBlockStartSample() + InEndFrame;
+        const int64 MinIntervalSamples = static_cast<int64>(FMath::Max(*MinIntervalInput, 0.0f) * Clock.GetSampleRate());
+
+        if (EndSample - LastOnsetSample < MinIntervalSamples)
+        {
+            return;
+        }
+
+        LastOnsetSample = EndSample;
+
+        OnsetTrigger->TriggerFrame(FMath::Max(InEndFrame - 1, 0));
+        // The onset happened somewhere in the newest hop, stamp it at its start (it may belong to the previous block).
+        SendMessageToListener(InEndFrame - HopSize, Flux);
+    }
+
+    const FVertexInterface& FNotifyOnsetOperator::GetVertexInterface()
+    {
+        using namespace NotifyOnsetNode;
+
+        static const FVertexInterface Interface(
+            FInputVertexInterface(
+                TInputDataVertexModel<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudio)),
+                TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID)),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameThreshold), 1.5f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameMinInterval), 0.1f)
+            ),
+            FOutputVertexInterface(
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameOnset))
+            )
+        );
+
+        return Interface;
+    }
+
+    const FNodeClassMetadata& FNotifyOnsetOperator::GetNodeInfo()
+    {
+        auto InitNodeInfo = []() -> FNodeClassMetadata
+        {
+            FNodeClassMetadata Info;
+
+            Info.ClassName        = { TEXT("UE"), TEXT("NotifyOnset"), TEXT("Notify Onset") };
+            Info.MajorVersion     = 1;
+            Info.MinorVersion     = 0;
+            Info.DisplayName      = LOCTEXT("Metasound_NotifyOnsetDisplayName", "Notify Onset");
+            Info.Description      = LOCTEXT("Metasound_NotifyOnsetNodeDescription", "Detects onsets (drum hits, note attacks...) in the audio with spectral flux, and sends an onset notify with their strength. Onset notifies are received through the MetaSounds Notify Event and Batch events.");
+            Info.Author           = PluginAuthor;
+            Info.PromptIfMissing  = PluginNodeMissingPrompt;
+            Info.DefaultInterface = GetVertexInterface();
+            Info.CategoryHierarchy = { LOCTEXT("Metasound_NotifyOnsetNodeCategory", "Notify") };
+
+            return Info;
+        };
+
+        static const FNodeClassMetadata Info = InitNodeInfo();
+
+        return Info;
+    }
+
+    TUniquePtr<IOperator> FNotifyOnsetOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace NotifyOnsetNode;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudio), InParams.OperatorSettings);
+        FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
+        FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
+        FFloatReadRef ThresholdIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameThreshold), InParams.OperatorSettings);
+        FFloatReadRef MinIntervalIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameMinInterval), InParams.OperatorSettings);
+
+        return MakeUnique<FNotifyOnsetOperator>(InParams.OperatorSettings, InParams.Environment, AudioIn, AddressIn, ListenerHandleIn, IDIn, ThresholdIn, MinIntervalIn);
+    }
+
+    void FNotifyOnsetOperator::SendMessageToListener(int32 InFrame, float InStrength){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
+
+        FMetaSoundNotifyRecord Record;
+
+        if (ListenerCache.Resolve(*AddressInput, *ListenerHandleInput, Record.Listener))
+        {
+            Record.Type = EMetaSoundNotifyType::Onset;
+            Record.NotifyID = *IDInput;
+            Record.FloatValue = InStrength;
+
+            Clock.Stamp(InFrame, Record);
+
+            FMetaSoundNotifyDispatcher::Get().Enqueue(Record);
+        }
+    }
+    #pragma endregion
+
+    #pragma region NODE
+    class FNotifyOnsetNode : public FNodeFacade
+    {
+    public:
+        FNotifyOnsetNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FNotifyOnsetOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FNotifyOnsetNode)
+    #pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,453 @@
+#pragma once
+
+#include "MetasoundParamHelper.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundFacade.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
+#include <type_traits>
+
+// Define a localized namespace for the node!
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyNode"
+
+namespace Metasound
+{
+    // Specify your parameter names and descriptions here.
+    #pragma region PARAMETERS
+    // Create your own namespace for the node!
+    namespace NotifyNode
+    {
+        // Every parameter must start with a fixed naming convention! InParamName for inputs and OutParamName for outputs! I.e.:
+        // METASOUND_PARAM(InParamNameMyInput, "Name to display in the graph.", "Description to display in the graph.")
+        // METASOUND_PARAM(OutParamNameMyOutput, "Name to display in the graph.", "Description to display in the graph.")
+        // The value input is different for every payload, its name and description come from the payload traits.
+
+        // Inputs
+        METASOUND_PARAM(InParamNameSend, "Send", "Sends the notify.")
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
+        METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
+        METASOUND_PARAM(InParamNameWatch, "Watch", "Sends the notify on its own whenever the value changes, no need to trigger Send.")
+        METASOUND_PARAM(InParamNameEpsilon, "Epsilon", "Smallest change of the value that sends a notify in watch mode.")
+        METASOUND_PARAM(InParamNameMinInterval, "Min Interval", "Minimum number of samples between two notifies sent in watch mode. A change happening in between is sent once it elapses.")
+        // Outputs
+        METASOUND_PARAM(OutParamNameSent, "On Sent", "Triggered after we send the notify.")
+    }
+    #pragma endregion
+
+    /**
+     * @name TNotifyPayloadTraits
+     * @brief Everything that changes between two notify nodes. Specialize it for your payload type, then register
+     * TNotifyNode<YourType> and you have a new node. See MetaSoundNotifyNode.cpp for every existing payload.
+     *
+     * A specialization must provide:
+     *  - Type, MinorVersion, bCanWatch and bHasEpsilon constants.
+     *  - GetClassName(), GetDisplayName() and GetDescription() for the node info.
+     *  - GetValueName(), GetValueMetadata() and Write() if the payload is not void.
+     *  - HasChanged() if bCanWatch is true.
+     * Inherit FNotifyPayloadTraitsBase, and override FState if Write() needs to keep something per node.
+     */
+    template<typename PayloadType>
+    struct TNotifyPayloadTraits;
+
+    struct FNotifyPayloadTraitsBase
+    {
+        // State of the payload kept by every node, passed into Write().
+        struct FState
+        {
+        };
+    };
+
+    // Create your operator and main behavior here.
+    #pragma region OPERATOR
+    /**
+     * @name TNotifyOperator
+     * @brief Send trigger, listener and optional value. Shared by every simple notify node, only the payload traits
+     * differ, so each node is specialized at compile time without any runtime branching on its type.
+     */
+    template<typename PayloadType>
+    class TNotifyOperator : public TExecutableOperator<TNotifyOperator<PayloadType>>
+    {
+        using FTraits = TNotifyPayloadTraits<PayloadType>;
+
+        static constexpr bool bHasValue = !std::is_void<PayloadType>::value;
+        static constexpr bool bCanWatch = bHasValue && FTraits::bCanWatch;
+
+        struct FNoValue
+        {
+        };
+
+        // Nodes without payload (Notify) don't store any value.
+        using FValue = std::conditional_t<bHasValue, PayloadType, FNoValue>;
+        using FValueReadRef = std::conditional_t<bHasValue, TDataReadReference<FValue>, FNoValue>;
+
+    public:
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        // Declare every input you want for your node in this constructor.
+        TNotifyOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
+        const FTriggerReadRef& InSend,
+        const FStringReadRef& InAddressInput,
+        const FInt32ReadRef& InListenerHandleInput,
+        const FInt32ReadRef& InIDInput,
+        const FValueReadRef& InValueInput,
+        const FBoolReadRef& InWatchInput,
+        const FFloatReadRef& InEpsilonInput,
+        const FInt32ReadRef& InMinIntervalInput)
+        :
+        // Set inputs
+        SendTrigger(InSend),
+        AddressInput(InAddressInput),
+        ListenerHandleInput(InListenerHandleInput),
+        IDInput(InIDInput),
+        ValueInput(InValueInput),
+        WatchInput(InWatchInput),
+        EpsilonInput(InEpsilonInput),
+        MinIntervalInput(InMinIntervalInput),
+        // Create the output
+        SentTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+        ListenerCache(InEnvironment),
+        Clock(InSettings)
+        {
+        }
+
+        // Override GetInputs & GetOutputs
+        virtual FDataReferenceCollection GetInputs()  const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+
+        // Function that will execute the node behavior.
+        void Execute();
+
+    private:
+        // Declare any input parameters you want. For internal use only.
+        FTriggerReadRef SendTrigger;
+        FStringReadRef AddressInput;
+        FInt32ReadRef ListenerHandleInput;
+        FInt32ReadRef IDInput;
+        FValueReadRef ValueInput;
+        // Only exposed by payloads supporting watch mode.
+        FBoolReadRef WatchInput;
+        FFloatReadRef EpsilonInput;
+        FInt32ReadRef MinIntervalInput;
+
+        // Declare any output parameters you want. For internal use only.
+        FTriggerWriteRef SentTrigger;
+
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+
+        typename FTraits::FState PayloadState;
+
+        // Last value sent, compared against in watch mode.
+        FValue LastSentValue = FValue();
+        int64 LastSentSample = 0;
+        bool bHasSentValue = false;
+
+        // Custom functions for this specific node
+        void WatchValue();
+        void SendMessageToListener(int32 InFrame);
+    };
+
+    /**
+     * @brief Specify the inputs in this function.
+     * @warning This is obligatory to have! If we don't want any inputs (weird), just don't add any reference to the input collection.
+    */
+    template<typename PayloadType>
+    FDataReferenceCollection TNotifyOperator<PayloadType>::GetInputs() const
+    {
+        using namespace NotifyNode;
+
+        FDataReferenceCollection InputDataReferences;
+
+        // Create a data reference por each input, never forget ; at the end!
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameSend), SendTrigger);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), AddressInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
+
+        if constexpr (bHasValue)
+        {
+            InputDataReferences.AddDataReadReference(FTraits::GetValueName(), ValueInput);
+        }
+
+        if constexpr (bCanWatch)
+        {
+            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameWatch), WatchInput);
+            if constexpr (FTraits::bHasEpsilon)
+            {
+                InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameEpsilon), EpsilonInput);
+            }
+            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameMinInterval), MinIntervalInput);
+        }
+
+        return InputDataReferences;
+    }
+
+    /**
+     * @brief Specify your outputs here.
+     * @warning This is obligatory to have! If we don't want any output, just don't add any reference to the output collection.
+     */
+    template<typename PayloadType>
+    FDataReferenceCollection TNotifyOperator<PayloadType>::GetOutputs() const
+    {
+        using namespace NotifyNode;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        // Create a data reference por each output, never forget ; at the end!
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamNameSent), SentTrigger);
+
+        return OutputDataReferences;
+    }
+
+    /**
+     * @brief Main executor function! Place your node logic here.
+     * @warning Important information about triggers inside.
+    */
+    template<typename PayloadType>
+    void TNotifyOperator<PayloadType>::Execute()
+    {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
+        // For every trigger output we have, we need to advance its block! This is OBLIGATORY if we want the output triggers to work.
+        // I did not test if we need to do the same with non-trigger outputs, be cautious and test yourself.
+        SentTrigger->AdvanceBlock();
+
+        // This is the function that will execute once we call our input trigger.
+        SendTrigger->ExecuteBlock(
+			[](int32, int32)
+			{
+			},
+			[this](int32 StartFrame, int32 EndFrame)
+			{
+                // Call custom function to execute message.
+                SendMessageToListener(StartFrame);
+                // Execute the output trigger.
+                SentTrigger->TriggerFrame(StartFrame);
+			}
+		);
+
+        if constexpr (bCanWatch)
+        {
+            if (*WatchInput)
+            {
+                WatchValue();
+            }
+        }
+
+        Clock.AdvanceBlock();
+    }
+
+    template<typename PayloadType>
+    void TNotifyOperator<PayloadType>::WatchValue()
+    {
+        if constexpr (bCanWatch)
+        {
+            // Only real changes count, so a slowly drifting value doesn't flood the listener.
+            if (bHasSentValue && !FTraits::HasChanged(*ValueInput, LastSentValue, FMath::Max(*EpsilonInput, 0.0f)))
+            {
+                return;
+            }
+
+            if (bHasSentValue && Clock.GetBlockStartSample() - LastSentSample < *MinIntervalInput)
+            {
+                return;
+            }
+
+            SendMessageToListener(0);
+            SentTrigger->TriggerFrame(0);
+        }
+    }
+
+    /**
+     * @brief Here, you will specify the interface for the node. Don't forget to do inputs and outputs!
+    */
+    template<typename PayloadType>
+    const FVertexInterface& TNotifyOperator<PayloadType>::GetVertexInterface()
+    {
+        using namespace NotifyNode;
+
+        auto MakeInputInterface = []() -> FInputVertexInterface
+        {
+            // Create an FInputVertexInterface and fill it with your inputs. Specify the correct data type for every parameter!
+            // Do NOT forget comas!
+            FInputVertexInterface InputInterface(
+                TInputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameSend)),
+                TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID))
+            );
+
+            // Optional inputs are appended depending on the payload.
+            if constexpr (bHasValue)
+            {
+                InputInterface.Add(TInputDataVertexModel<FValue>(FTraits::GetValueName(), FTraits::GetValueMetadata()));
+            }
+
+            if constexpr (bCanWatch)
+            {
+                InputInterface.Add(TInputDataVertexModel<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameWatch), false));
+                if constexpr (FTraits::bHasEpsilon)
+                {
+                    InputInterface.Add(TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameEpsilon), 0.001f));
+                }
+                InputInterface.Add(TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameMinInterval), 0));
+            }
+
+            return InputInterface;
+        };
+
+        // Create the interface and fill it.
+        static const FVertexInterface Interface(
+            MakeInputInterface(),
+
+            // Create an FOutputVertexInterface and fill it with your outputs. Specify the correct data type for every parameter!
+            // Do NOT forget comas!
+            FOutputVertexInterface(
+                // You can leave this empty if you don't have any outputs.
+                TOutputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameSent))
+            )
+        );
+
+        return Interface;
+    }
+
+    /**
+     * @brief Node info comes from the payload traits.
+    */
+    template<typename PayloadType>
+    const FNodeClassMetadata& TNotifyOperator<PayloadType>::GetNodeInfo()
+    {
+        auto InitNodeInfo = []() -> FNodeClassMetadata
+        {
+            FNodeClassMetadata Info;
+
+            Info.ClassName        = FTraits::GetClassName();
+            Info.MajorVersion     = 1;
+            Info.MinorVersion     = FTraits::MinorVersion;
+            Info.DisplayName      = FTraits::GetDisplayName();
+            Info.Description      = FTraits::GetDescription();
+            Info.Author           = PluginAuthor;
+            Info.PromptIfMissing  = PluginNodeMissingPrompt;
+            Info.DefaultInterface = GetVertexInterface();
+            Info.CategoryHierarchy = { LOCTEXT("Metasound_NotifyNodeCategory", "Notify") };
+
+            return Info;
+        };
+
+        static const FNodeClassMetadata Info = InitNodeInfo();
+
+        return Info;
+    }
+
+    /**
+     * @brief Once again, specify your inputs here. Follow the function structure.
+    */
+    template<typename PayloadType>
+    TUniquePtr<IOperator> TNotifyOperator<PayloadType>::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace NotifyNode;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FTriggerReadRef SendTrigger = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamNameSend), InParams.OperatorSettings);
+        FStringReadRef AddressIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
+        FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
+
+        FValueReadRef ValueIn = [&]() -> FValueReadRef
+        {
+            if constexpr (bHasValue)
+            {
+                return InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FValue>(InputInterface, FTraits::GetValueName(), InParams.OperatorSettings);
+            }
+            else
+            {
+                return FNoValue();
+            }
+        }();
+
+        // Payloads without watch mode don't expose these, they just keep their default value.
+        FBoolReadRef WatchIn = FBoolReadRef::CreateNew(false);
+        FFloatReadRef EpsilonIn = FFloatReadRef::CreateNew(0.0f);
+        FInt32ReadRef MinIntervalIn = FInt32ReadRef::CreateNew(0);
+
+        if constexpr (bCanWatch)
+        {
+            WatchIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<bool>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameWatch), InParams.OperatorSettings);
+            if constexpr (FTraits::bHasEpsilon)
+            {
+                EpsilonIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameEpsilon), InParams.OperatorSettings);
+            }
+            MinIntervalIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameMinInterval), InParams.OperatorSettings);
+        }
+
+        return MakeUnique<TNotifyOperator<PayloadType>>(InParams.OperatorSettings, InParams.Environment, SendTrigger, AddressIn, ListenerHandleIn, IDIn, ValueIn, WatchIn, EpsilonIn, MinIntervalIn);
+    }
+
+    /**
+     * @brief Function to send the interface message.
+    */
+    template<typename PayloadType>
+    void TNotifyOperator<PayloadType>::SendMessageToListener(int32 InFrame){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
+
+        FMetaSoundNotifyRecord Record;
+
+        if constexpr (bCanWatch)
+        {
+            LastSentValue = *ValueInput;
+            LastSentSample = Clock.GetBlockStartSample() + InFrame;
+            bHasSentValue = true;
+        }
+
+        // Get the listener from the handle, or from the string. The cache only parses the string again if it changed.
+        if (ListenerCache.Resolve(*AddressInput, *ListenerHandleInput, Record.Listener))
+        {
+            // We never call the listener from here, this runs on the audio render thread!
+            // Push the notify into the dispatcher queue instead, it will call the interface on the game thread.
+            Record.Type = FTraits::Type;
+            Record.NotifyID = *IDInput;
+
+            if constexpr (bHasValue)
+            {
+                FTraits::Write(*ValueInput, PayloadState, Record);
+            }
+
+            Clock.Stamp(InFrame, Record);
+
+            FMetaSoundNotifyDispatcher::Get().Enqueue(Record);
+        }
+    }
+    #pragma endregion
+
+    // Create your node class here
+    #pragma region NODE
+    /**
+     * @name TNotifyNode class.
+     * @brief Node of a payload. Register it with METASOUND_REGISTER_NODE through an alias, i.e.:
+     * using FNotifyFloatNode = TNotifyNode<float>;
+    */
+    template<typename PayloadType>
+    class TNotifyNode : public FNodeFacade
+    {
+    public:
+        // Constructor used by the Metasound Frontend.
+        TNotifyNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<TNotifyOperator<PayloadType>>())
+        {
+        }
+    };
+    #pragma endregion
+}
+
+// Close localized namespace
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,105 @@
+#include "MetaSoundNotifyOperatorHarness.h"
+#include "MetaSoundNotify.h"
+#include "MetasoundFrontendRegistries.h"
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundOperatorBuilder.h"
+
+FMetaSoundNotifyOperatorHarness::FMetaSoundNotifyOperatorHarness(const Metasound::FOperatorSettings& InSettings)
+: Settings(InSettings)
+{
+}
+
+bool FMetaSoundNotifyOperatorHarness::CreateNode(const Metasound::FNodeClassName& InClassName, int32 InMajorVersion, int32 InMinorVersion)
+{
+    using namespace Metasound;
+
+    FNodeClassMetadata Metadata;
+    Metadata.ClassName = InClassName;
+    Metadata.MajorVersion = InMajorVersion;
+    Metadata.MinorVersion = InMinorVersion;
+
+    const Frontend::FNodeRegistryKey Key = FMetasoundFrontendRegistryContainer::GetRegistryKey(Metadata);
+
+    FNodeInitData InitData;
+    InitData.InstanceName = InClassName.GetName();
+    InitData.InstanceID = FGuid::NewGuid();
+
+    Node = FMetasoundFrontendRegistryContainer::Get()->CreateNode(Key, InitData);
+    if (!Node.IsValid())
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Node %s %d.%d isn't registered."), *InClassName.GetFullName().ToString(), InMajorVersion, InMinorVersion);
+        return false;
+    }
+
+    return true;
+}
+
+Metasound::FTriggerWriteRef FMetaSoundNotifyOperatorHarness::AddTrigger(const Metasound::FVertexName& InName)
+{
+    Metasound::FTriggerWriteRef Trigger = Metasound::FTriggerWriteRef::CreateNew(Settings);
+    Inputs.AddDataReadReference(InName, Metasound::FTriggerReadRef(Trigger));
+    Triggers.Add(Trigger);
+    return Trigger;
+}
+
+bool FMetaSoundNotifyOperatorHarness::CreateOperator()
+{
+    using namespace Metasound;
+
+    if (!Node.IsValid())
+    {
+        return false;
+    }
+
+    FBuildErrorArray Errors;
+    const FCreateOperatorParams Params{ *Node, Settings, Inputs, Environment };
+    Operator = Node->GetDefaultOperatorFactory()->CreateOperator(Params, Errors);
+
+    for (const TUniquePtr<IOperatorBuildError>& Error : Errors)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't create the operator of %s: %s"), *Node->GetInstanceName().ToString(), *Error->GetErrorDescription().ToString());
+    }
+
+    if (!Operator.IsValid())
+    {
+        return false;
+    }
+
+    ExecuteFunction = Operator->GetExecuteFunction();
+    return true;
+}
+
+bool FMetaSoundNotifyOperatorHarness::CreateGraphOperator(const Metasound::IGraph& InGraph)
+{
+    using namespace Metasound;
+
+    FOperatorBuilder Builder(FOperatorBuilderSettings::GetDefaultSettings());
+    FBuildResults Results;
+    Operator = Builder.BuildGraphOperator(InGraph, Settings, Inputs, Environment, Results);
+
+    for (const TUniquePtr<IOperatorBuildError>& Error : Results.Errors)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't create the operator of the graph: %s"), *Error->GetErrorDescription().ToString());
+    }
+
+    if (!Operator.IsValid())
+    {
+        return false;
+    }
+
+    ExecuteFunction = Operator->GetExecuteFunction();
+    return true;
+}
+
+void FMetaSoundNotifyOperatorHarness::Execute()
+{
+    if (ExecuteFunction)
+    {
+        ExecuteFunction(Operator.Get());
+    }
+
+    for (Metasound::FTriggerWriteRef& Trigger : Triggers)
+    {
+        Trigger->AdvanceBlock();
+    }
+}
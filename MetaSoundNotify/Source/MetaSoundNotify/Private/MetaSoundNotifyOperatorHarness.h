@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundEnvironment.h"
+#include "MetasoundGraphInterface.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundOperatorSettings.h"
+#include "MetasoundTrigger.h"
+
+/**
+ * @name FMetaSoundNotifyOperatorHarness
+ * @brief Runs the operator of a registered node, or of a whole graph, outside of any audio device. Used by the
+ * benchmarks and the offline renders.
+ * The node is created through the frontend registry exactly like a graph would, its inputs are owned by the harness and
+ * can be written between blocks. Not thread safe: set the inputs and execute from the same thread.
+ */
+class FMetaSoundNotifyOperatorHarness
+{
+public:
+    explicit FMetaSoundNotifyOperatorHarness(const Metasound::FOperatorSettings& InSettings);
+
+    /** Creates the node of this class (namespace, name and variant) and version. Returns false if it isn't registered. */
+    bool CreateNode(const Metasound::FNodeClassName& InClassName, int32 InMajorVersion, int32 InMinorVersion);
+
+    /** Adds an input with its initial value. Inputs that are never added use their default. */
+    template<typename DataType>
+    Metasound::TDataWriteReference<DataType> AddInput(const Metasound::FVertexName& InName, const DataType& InValue)
+    {
+        Metasound::TDataWriteReference<DataType> Input = Metasound::TDataWriteReference<DataType>::CreateNew(InValue);
+        Inputs.AddDataReadReference(InName, Metasound::TDataReadReference<DataType>(Input));
+        return Input;
+    }
+
+    /** Adds a trigger input, trigger it before executing a block. */
+    Metasound::FTriggerWriteRef AddTrigger(const Metasound::FVertexName& InName);
+
+    /** Creates the operator from the node and the inputs added so far. Returns false and logs the errors if it fails. */
+    bool CreateOperator();
+
+    /** Creates the operator of a whole graph from the inputs added so far, instead of a node. */
+    bool CreateGraphOperator(const Metasound::IGraph& InGraph);
+
+    /** Renders one block and advances the triggers added to the harness. */
+    void Execute();
+
+    const Metasound::FOperatorSettings& GetSettings() const
+    {
+        return Settings;
+    }
+
+private:
+    Metasound::FOperatorSettings Settings;
+    Metasound::FMetasoundEnvironment Environment;
+    Metasound::FDataReferenceCollection Inputs;
+    TArray<Metasound::FTriggerWriteRef> Triggers;
+    TUniquePtr<Metasound::INode> Node;
+    TUniquePtr<Metasound::IOperator> Operator;
+    Metasound::IOperator::FExecuteFunction ExecuteFunction = nullptr;
+};
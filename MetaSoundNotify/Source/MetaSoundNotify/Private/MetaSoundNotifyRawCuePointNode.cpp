@@ -1,6 +1,9 @@
 #include "MetasoundParamHelper.h"
 #include "MetasoundEnumRegistrationMacro.h"
-#include "MetaSoundNotifyInterface.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyClock.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifyStats.h"
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_NotifyRawCuePointNode"
 
@@ -10,7 +13,8 @@ namespace Metasound
     namespace NotifyRawCuePointNode
     {
         METASOUND_PARAM(InParamNameListen, "Listen", "Sets the node behaviour active.")
-        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string.")
+        METASOUND_PARAM(InParamNameAddress, "To Notify", "Soft reference of the object to notify passed into a string. When empty, the owner of the audio component playing the MetaSound is notified.")
+        METASOUND_PARAM(InParamNameListenerHandle, "Listener Handle", "Handle returned when registering the listener in the MetaSound Notify subsystem. Used instead of To Notify when not 0.")
         METASOUND_PARAM(InParamNameNotifyID, "Notify ID", "ID of this notify node. Useful when dealing with multiple nodes of the same kind notifying to the same listener.")
         METASOUND_PARAM(InParamNameMsg, "Message", "Custom message to send. For example, the cue point ID, label, instructions...")
         METASOUND_PARAM(InParamNamePlayback, "Playback Position", "Current playback position of the sound.")
@@ -29,8 +33,10 @@ namespace Metasound
         static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
 
         FNotifyRawCuePointOperator(const FOperatorSettings& InSettings,
+        const FMetasoundEnvironment& InEnvironment,
         const FTriggerReadRef& InListenInput,
         const FStringReadRef& InStrInput,
+        const FInt32ReadRef& InListenerHandleInput,
         const FInt32ReadRef& InIDInput,
         const FStringReadRef& InMsgInput,
         const FFloatReadRef& InPlaybackInput,
@@ -45,6 +51,7 @@ namespace Metasound
     private:
         FTriggerReadRef TriggerListenInput;
         FStringReadRef StrInput;
+        FInt32ReadRef ListenerHandleInput;
         FInt32ReadRef IDInput;
         FStringReadRef MsgInput;
         FFloatReadRef PlaybackInput;
@@ -53,13 +60,29 @@ namespace Metasound
 
         FTriggerWriteRef SentTrigger;
 
+        FMetaSoundNotifyListenerCache ListenerCache;
+        FMetaSoundNotifyClock Clock;
+        FMetaSoundNotifyMessageCache MessageCache;
+
         bool Listening;
-        void SendMessageToListener();
+        // Listening was turned on at least once, so a loop can re-arm the node.
+        bool bWasArmed = false;
+        // Set when a loop re-armed the node: it then waits for the playback to actually cross the cue point.
+        bool bCrossingOnly = false;
+        bool bHasLastPlayback = false;
+        float LastPlayback = 0.0f;
+        // How much the playback position moved during the last block it moved forward.
+        float PlaybackStep = 0.0f;
+        int32 LoopIteration = 0;
+
+        void SendMessageToListener(int32 InFrame);
     };
     
     FNotifyRawCuePointOperator::FNotifyRawCuePointOperator(const FOperatorSettings& InSettings,
+    const FMetasoundEnvironment& InEnvironment,
     const FTriggerReadRef& InListenInput,
     const FStringReadRef& InStrInput,
+    const FInt32ReadRef& InListenerHandleInput,
     const FInt32ReadRef& InIDInput,
     const FStringReadRef& InMsgInput,
     const FFloatReadRef& InPlaybackInput,
@@ -68,14 +91,18 @@ namespace Metasound
     :
     TriggerListenInput(InListenInput),
     StrInput(InStrInput),
+    ListenerHandleInput(InListenerHandleInput),
     IDInput(InIDInput),
     MsgInput(InMsgInput),
     PlaybackInput(InPlaybackInput),
     CuePointInput(InCuePointInput),
     StartListeningInput(InStartListeningInput),
-    SentTrigger(FTriggerWriteRef::CreateNew(InSettings))
+    SentTrigger(FTriggerWriteRef::CreateNew(InSettings)),
+    ListenerCache(InEnvironment),
+    Clock(InSettings)
     {
         Listening = *InStartListeningInput;
+        bWasArmed = Listening;
     }
 
     FDataReferenceCollection FNotifyRawCuePointOperator::GetInputs() const
@@ -86,6 +113,7 @@ namespace Metasound
 
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListen), TriggerListenInput);
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameAddress), StrInput);
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), ListenerHandleInput);
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameNotifyID), IDInput);
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNameMsg), MsgInput);
         InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNamePlayback), PlaybackInput);
@@ -108,6 +136,8 @@ namespace Metasound
 
     void FNotifyRawCuePointOperator::Execute()
     {
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifyExecute);
+
 		SentTrigger->AdvanceBlock();
         
         TriggerListenInput->ExecuteBlock(
@@ -117,15 +147,67 @@ namespace Metasound
 			[this](int32 StartFrame, int32 EndFrame)
 			{
                 Listening = 1;
+                bWasArmed = true;
+                bCrossingOnly = false;
                 SentTrigger->TriggerFrame(StartFrame);
 			}
 		);
 
-        if (Listening && !StrInput->IsEmpty()){
-            if (*PlaybackInput > *CuePointInput){
-                SendMessageToListener();
+        const float Playback = *PlaybackInput;
+        const float CuePoint = *CuePointInput;
+
+        // Range of positions the playback went through during this block.
+        float SegmentStart = bHasLastPlayback ? LastPlayback : Playback;
+
+        if (bHasLastPlayback && Playback < LastPlayback){
+            // The playback jumped back: the sound looped. The block first went from the last position to the loop end,
+            // one step at most, so a cue point still waiting in that tail was crossed before the wrap.
+            const bool bInTail = CuePoint > LastPlayback && CuePoint <= LastPlayback + PlaybackStep;
+
+            if (Listening && bInTail && ListenerCache.CanResolve(*StrInput, *ListenerHandleInput)){
+                const int32 NumFrames = Clock.GetNumFramesPerBlock();
+                const float Alpha = (CuePoint - LastPlayback) / PlaybackStep;
+                SendMessageToListener(FMath::Clamp(FMath::FloorToInt(Alpha * NumFrames), 0, NumFrames - 1));
+            }
+
+            // Then our best guess of where the block restarted is one step before the current position (with a bit of
+            // slack so a cue point right at the loop start isn't missed).
+            ++LoopIteration;
+            SegmentStart = Playback - PlaybackStep - KINDA_SMALL_NUMBER;
+
+            if (bWasArmed){
+                Listening = 1;
+                bCrossingOnly = true;
+            }
+        }
+        else if (bHasLastPlayback && Playback > LastPlayback){
+            PlaybackStep = Playback - LastPlayback;
+        }
+
+        if (Listening && ListenerCache.CanResolve(*StrInput, *ListenerHandleInput)){
+            if (Playback > CuePoint){
+                const bool bCrossed = SegmentStart <= CuePoint;
+
+                // When armed by hand we also send if the cue point was already behind us, like we always did.
+                if (bCrossed || !bCrossingOnly){
+                    int32 Frame = 0;
+
+                    if (bCrossed){
+                        // Place the crossing inside the block, assuming the playback moved linearly.
+                        const int32 NumFrames = Clock.GetNumFramesPerBlock();
+                        const float Alpha = (CuePoint - SegmentStart) / (Playback - SegmentStart);
+                        Frame = FMath::Clamp(FMath::FloorToInt(Alpha * NumFrames), 0, NumFrames - 1);
+                    }
+
+                    SendMessageToListener(Frame);
+                }
             }
         }
+
+        LastPlayback = Playback;
+        bHasLastPlayback = true;
+
+        Clock.AdvanceBlock();
     }
 
     const FVertexInterface& FNotifyRawCuePointOperator::GetVertexInterface()
@@ -136,6 +218,7 @@ namespace Metasound
             FInputVertexInterface(
                 TInputDataVertexModel<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListen)),
                 TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAddress)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameListenerHandle)),
                 TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameNotifyID)),
                 TInputDataVertexModel<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameMsg)),
                 TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePlayback)),
@@ -159,9 +242,9 @@ namespace Metasound
 
             Info.ClassName        = { TEXT("UE"), TEXT("NotifyRawCuePoint"), TEXT("Notify Raw Cue Point") };
             Info.MajorVersion     = 1;
-            Info.MinorVersion     = 0;
+            Info.MinorVersion     = 2;
             Info.DisplayName      = LOCTEXT("Metasound_NotifyRawCuePointDisplayName", "Notify Raw Cue Point");
-            Info.Description      = LOCTEXT("Metasound_NotifyRawCuePointNodeDescription", "When triggered, waits for the playback position to reach the desired cue point position and sends a notify through the interface to the listener, after which it deactivate again. Use this if your audio file does not support or have cue points, and you need them. This simulates cue points.");
+            Info.Description      = LOCTEXT("Metasound_NotifyRawCuePointNodeDescription", "When triggered, waits for the playback position to reach the desired cue point position and sends a notify through the interface to the listener, after which it deactivate again. Use this if your audio file does not support or have cue points, and you need them. This simulates cue points. The notify is placed on the exact frame the cue point is crossed, and the node re-arms itself every time the playback loops back.");
             Info.Author           = PluginAuthor;
             Info.PromptIfMissing  = PluginNodeMissingPrompt;
             Info.DefaultInterface = GetVertexInterface();
@@ -184,23 +267,35 @@ namespace Metasound
         
         FTriggerReadRef ListenIn = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamNameListen), InParams.OperatorSettings);
         FStringReadRef StrIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameAddress), InParams.OperatorSettings);
+        FInt32ReadRef ListenerHandleIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameListenerHandle), InParams.OperatorSettings);
         FInt32ReadRef IDIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameNotifyID), InParams.OperatorSettings);
         FStringReadRef MsgIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameMsg), InParams.OperatorSettings);
         FFloatReadRef PlaybackIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNamePlayback), InParams.OperatorSettings);
         FFloatReadRef CuePointIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameCuePoint), InParams.OperatorSettings);
         FBoolReadRef StartListeningIn = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<bool>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameStartListening), InParams.OperatorSettings);
 
-        return MakeUnique<FNotifyRawCuePointOperator>(InParams.OperatorSettings, ListenIn, StrIn, IDIn, MsgIn, PlaybackIn, CuePointIn, StartListeningIn);
+        return MakeUnique<FNotifyRawCuePointOperator>(InParams.OperatorSettings, InParams.Environment, ListenIn, StrIn, ListenerHandleIn, IDIn, MsgIn, PlaybackIn, CuePointIn, StartListeningIn);
     }
 
-    void FNotifyRawCuePointOperator::SendMessageToListener(){
-        FSoftObjectPath SoftTarget(*StrInput);
-        TSoftObjectPtr<UObject> SoftTargetPtr(SoftTarget);
-        UObject* Target = SoftTargetPtr.Get();
+    void FNotifyRawCuePointOperator::SendMessageToListener(int32 InFrame){
+        SCOPE_CYCLE_COUNTER(STAT_MetaSoundNotifySend);
+
+        FMetaSoundNotifyRecord Record;
+
+        if (!ListenerCache.Resolve(*StrInput, *ListenerHandleInput, Record.Listener))
+        {
+            return;
+        }
+
+        Record.Type = EMetaSoundNotifyType::RawCuePoint;
+        Record.NotifyID = *IDInput;
+        Record.IntValue = LoopIteration;
+        Record.Message = MessageCache.Intern(*MsgInput);
+
+        Clock.Stamp(InFrame, Record);
 
-        if (Target && Target->GetClass()->ImplementsInterface(UMetaSoundNotifyInterface::StaticClass()))
+        if (FMetaSoundNotifyDispatcher::Get().Enqueue(Record))
         {
-            IMetaSoundNotifyInterface::Execute_MetaSoundsNotifyRawCuePoint(Target, *IDInput, *MsgInput);
             Listening = 0;
         }
     }
@@ -0,0 +1,565 @@
+#include "MetaSoundNotifyRecorder.h"
+#include "MetaSoundNotify.h"
+#include "MetaSoundNotifyListenerCache.h"
+#include "MetaSoundNotifySubsystem.h"
+#include "Algo/StableSort.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/SoftObjectPath.h"
+
+FMetaSoundNotifyRecorder& FMetaSoundNotifyRecorder::Get()
+{
+    static FMetaSoundNotifyRecorder Recorder;
+    return Recorder;
+}
+
+FMetaSoundNotifyRecorder::~FMetaSoundNotifyRecorder()
+{
+    // The module stops the recording on shutdown, don't touch the ticker or the file system this late.
+    bRecording.store(false, std::memory_order_relaxed);
+    Writer.Reset();
+}
+
+bool FMetaSoundNotifyRecorder::Start(const FString& InFilename)
+{
+    check(IsInGameThread());
+
+    Stop();
+
+    Writer.Reset(IFileManager::Get().CreateFileWriter(*InFilename));
+    if (!Writer)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't create the notify log %s."), *InFilename);
+        return false;
+    }
+
+    // Throw away what was captured after the previous recording stopped.
+    {
+        FScopeLock Lock(&ThreadBuffersLock);
+        for (const TUniquePtr<FThreadBuffer>& ThreadBuffer : ThreadBuffers)
+        {
+            while (ThreadBuffer->Notifies.Pop(Pending))
+            {
+            }
+        }
+    }
+
+    Pending = FCapturedNotify();
+    NumDropped.store(0, std::memory_order_relaxed);
+
+    Header = FMetaSoundNotifyLogHeader();
+    Header.EventsOffset = sizeof(FMetaSoundNotifyLogHeader);
+    Header.SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+
+    // Written again with the final counts when the recording stops.
+    Writer->Serialize(&Header, sizeof(Header));
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMetaSoundNotifyRecorder::Tick));
+    bRecording.store(true, std::memory_order_release);
+
+    UE_LOG(LogMetaSoundNotify, Display, TEXT("Recording notifies into %s."), *InFilename);
+    return true;
+}
+
+void FMetaSoundNotifyRecorder::Stop()
+{
+    check(IsInGameThread());
+
+    if (!Writer)
+    {
+        return;
+    }
+
+    bRecording.store(false, std::memory_order_release);
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    Flush();
+
+    Header.StringsOffset = Writer->Tell();
+    Header.NumMessages = Messages.Num();
+    Header.NumListeners = Listeners.Num();
+
+    auto WriteString = [this](const FString& InString)
+    {
+        FTCHARToUTF8 Utf8(*InString);
+        uint32 Length = Utf8.Length();
+        Writer->Serialize(&Length, sizeof(Length));
+        Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Length);
+    };
+
+    for (const FString& Message : Messages)
+    {
+        WriteString(Message);
+    }
+
+    for (const FString& Listener : Listeners)
+    {
+        WriteString(Listener);
+    }
+
+    Writer->Seek(0);
+    Writer->Serialize(&Header, sizeof(Header));
+
+    const bool bSucceeded = Writer->Close();
+    Writer.Reset();
+
+    UE_CLOG(!bSucceeded, LogMetaSoundNotify, Error, TEXT("Failed to write the notify log."));
+    UE_CLOG(bSucceeded, LogMetaSoundNotify, Display, TEXT("Recorded %llu notifies."), Header.NumEvents);
+
+    Messages.Empty();
+    MessageIndices.Empty();
+    Listeners.Empty();
+    ListenerIndices.Empty();
+    GroupListenerIndices.Empty();
+    ObjectListenerIndices.Empty();
+    Captured.Empty();
+    Events.Empty();
+}
+
+FMetaSoundNotifyRecorder::FThreadBuffer& FMetaSoundNotifyRecorder::GetThreadBuffer()
+{
+    thread_local FThreadBuffer* ThreadBuffer = nullptr;
+
+    if (!ThreadBuffer)
+    {
+        // Slow path, only taken the first time a thread records a notify.
+        FScopeLock Lock(&ThreadBuffersLock);
+        ThreadBuffer = ThreadBuffers.Add_GetRef(MakeUnique<FThreadBuffer>()).Get();
+    }
+
+    return *ThreadBuffer;
+}
+
+void FMetaSoundNotifyRecorder::Capture(const FMetaSoundNotifyRecord& InRecord)
+{
+    FCapturedNotify Notify;
+    Notify.Record = InRecord;
+    Notify.Cycles = FPlatformTime::Cycles64();
+
+    // Snapshot samples are not recorded, don't keep their block alive until the next flush.
+    Notify.Record.AudioBlock.SafeRelease();
+
+    if (!GetThreadBuffer().Notifies.Push(Notify))
+    {
+        NumDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool FMetaSoundNotifyRecorder::Tick(float DeltaTime)
+{
+    Flush();
+    return true;
+}
+
+void FMetaSoundNotifyRecorder::Flush()
+{
+    {
+        FScopeLock Lock(&ThreadBuffersLock);
+        for (const TUniquePtr<FThreadBuffer>& ThreadBuffer : ThreadBuffers)
+        {
+            while (ThreadBuffer->Notifies.Pop(Pending))
+            {
+                Captured.Add(MoveTemp(Pending));
+            }
+        }
+    }
+
+    if (const uint32 Dropped = NumDropped.exchange(0, std::memory_order_relaxed))
+    {
+        UE_LOG(LogMetaSoundNotify, Warning, TEXT("Notify recorder buffer was full, %u notifies are missing from the log."), Dropped);
+    }
+
+    if (Captured.Num() == 0)
+    {
+        return;
+    }
+
+    // Every thread has its own buffer, put the notifies of all threads back in the order they were sent.
+    Algo::StableSortBy(Captured, &FCapturedNotify::Cycles);
+
+    const UMetaSoundNotifySubsystem* Subsystem = UMetaSoundNotifySubsystem::Get();
+
+    Events.SetNum(Captured.Num(), false);
+
+    for (int32 Index = 0; Index < Captured.Num(); ++Index)
+    {
+        const FMetaSoundNotifyRecord& Record = Captured[Index].Record;
+        FMetaSoundNotifyLogEvent& Event = Events[Index];
+
+        Event = FMetaSoundNotifyLogEvent();
+        Event.Cycles = Captured[Index].Cycles;
+        Event.SampleIndex = Record.SampleIndex;
+        Event.SampleRate = Record.SampleRate;
+        Event.FloatValue = Record.FloatValue;
+        Event.NotifyID = Record.NotifyID;
+        Event.IntValue = Record.IntValue;
+        Event.Bar = Record.Bar;
+        Event.Beat = Record.Beat;
+        Event.MessageIndex = GetMessageIndex(Record.Message);
+        Event.ListenerIndex = GetListenerIndex(Record.Listener, Subsystem);
+        Event.Type = static_cast<uint8>(Record.Type);
+        Event.bBoolValue = Record.bBoolValue ? 1 : 0;
+    }
+
+    Writer->Serialize(Events.GetData(), Events.Num() * sizeof(FMetaSoundNotifyLogEvent));
+    Header.NumEvents += Events.Num();
+
+    // Releases the messages, so the nodes can reuse their buffers.
+    Captured.Reset();
+    ObjectListenerIndices.Reset();
+}
+
+int32 FMetaSoundNotifyRecorder::GetMessageIndex(const FMetaSoundNotifyMessageRef& InMessage)
+{
+    if (!InMessage.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    const FString& Text = InMessage->GetText();
+    if (const int32* Index = MessageIndices.Find(Text))
+    {
+        return *Index;
+    }
+
+    const int32 Index = Messages.Add(Text);
+    MessageIndices.Add(Text, Index);
+    return Index;
+}
+
+int32 FMetaSoundNotifyRecorder::GetListenerIndex(const FMetaSoundNotifyListener& InListener, const UMetaSoundNotifySubsystem* InSubsystem)
+{
+    if (!InListener.Group.IsNone())
+    {
+        if (const int32* Index = GroupListenerIndices.Find(InListener.Group))
+        {
+            return *Index;
+        }
+
+        const int32 Index = AddListener(FMetaSoundNotifyListenerCache::GroupPrefix + InListener.Group.ToString());
+        GroupListenerIndices.Add(InListener.Group, Index);
+        return Index;
+    }
+
+    if (InListener.Address.IsValid())
+    {
+        return AddListener(InListener.Address->GetText());
+    }
+
+    // Handles and owners only mean something in the session they were recorded in, keep the object they point to.
+    UObject* Target = FMetaSoundNotifyDispatcher::ResolveTarget(InListener, InSubsystem);
+    if (!Target)
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Index = ObjectListenerIndices.Find(Target))
+    {
+        return *Index;
+    }
+
+    const int32 Index = AddListener(Target->GetPathName());
+    ObjectListenerIndices.Add(Target, Index);
+    return Index;
+}
+
+int32 FMetaSoundNotifyRecorder::AddListener(const FString& InAddress)
+{
+    if (const int32* Index = ListenerIndices.Find(InAddress))
+    {
+        return *Index;
+    }
+
+    const int32 Index = Listeners.Add(InAddress);
+    ListenerIndices.Add(InAddress, Index);
+    return Index;
+}
+
+FMetaSoundNotifyReplay::~FMetaSoundNotifyReplay()
+{
+    Close();
+}
+
+bool FMetaSoundNotifyReplay::Open(const FString& InFilename, UObject* InListener)
+{
+    Close();
+
+    MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*InFilename));
+    if (!MappedFile)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't open the notify log %s."), *InFilename);
+        return false;
+    }
+
+    const int64 FileSize = MappedFile->GetFileSize();
+    if (FileSize < static_cast<int64>(sizeof(FMetaSoundNotifyLogHeader)))
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("%s is not a notify log."), *InFilename);
+        Close();
+        return false;
+    }
+
+    MappedRegion.Reset(MappedFile->MapRegion(0, FileSize));
+    if (!MappedRegion)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't map the notify log %s."), *InFilename);
+        Close();
+        return false;
+    }
+
+    const uint8* Data = MappedRegion->GetMappedPtr();
+    FMemory::Memcpy(&Header, Data, sizeof(Header));
+
+    const uint64 EventsEnd = Header.EventsOffset + Header.NumEvents * sizeof(FMetaSoundNotifyLogEvent);
+
+    if (Header.Magic != FMetaSoundNotifyLogHeader::MagicNumber || Header.Version != FMetaSoundNotifyLogHeader::CurrentVersion)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("%s is not a notify log, or was recorded by another version."), *InFilename);
+        Close();
+        return false;
+    }
+
+    // A log whose recording never stopped has no string table and its header was never updated.
+    if (Header.EventsOffset != sizeof(FMetaSoundNotifyLogHeader) || EventsEnd > Header.StringsOffset || Header.StringsOffset > static_cast<uint64>(FileSize))
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("The notify log %s is truncated."), *InFilename);
+        Close();
+        return false;
+    }
+
+    OverrideListener = InListener;
+    Events = MakeArrayView(reinterpret_cast<const FMetaSoundNotifyLogEvent*>(Data + Header.EventsOffset), static_cast<int64>(Header.NumEvents));
+
+    const uint8* String = Data + Header.StringsOffset;
+    const uint8* End = Data + FileSize;
+    const uint32 NumStrings = Header.NumMessages + Header.NumListeners;
+
+    Messages.Reserve(Header.NumMessages);
+    Listeners.Reserve(Header.NumListeners);
+
+    for (uint32 Index = 0; Index < NumStrings; ++Index)
+    {
+        uint32 Length = 0;
+        if (End - String < static_cast<int64>(sizeof(Length)))
+        {
+            break;
+        }
+
+        FMemory::Memcpy(&Length, String, sizeof(Length));
+        String += sizeof(Length);
+
+        if (End - String < static_cast<int64>(Length))
+        {
+            break;
+        }
+
+        const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(String), Length);
+        const FString Text(Converted.Length(), Converted.Get());
+        String += Length;
+
+        if (Index < Header.NumMessages)
+        {
+            Messages.Add(new FMetaSoundNotifyMessage(Text));
+            continue;
+        }
+
+        // Resolved once here, the replay never parses an address again.
+        FMetaSoundNotifyListener& Listener = Listeners.AddDefaulted_GetRef();
+
+        if (InListener)
+        {
+            continue;
+        }
+
+        if (Text.StartsWith(FMetaSoundNotifyListenerCache::GroupPrefix, ESearchCase::IgnoreCase))
+        {
+            Listener.Group = FName(*Text.RightChop(FCString::Strlen(FMetaSoundNotifyListenerCache::GroupPrefix)));
+        }
+        else
+        {
+            Listener.Object = FSoftObjectPath(Text).ResolveObject();
+            UE_CLOG(!Listener.Object.IsValid(), LogMetaSoundNotify, Warning, TEXT("Recorded listener %s doesn't exist, its notifies won't be delivered."), *Text);
+        }
+    }
+
+    if (Messages.Num() != Header.NumMessages || Listeners.Num() != Header.NumListeners)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("The string table of the notify log %s is truncated."), *InFilename);
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void FMetaSoundNotifyReplay::Close()
+{
+    Events = TArrayView64<const FMetaSoundNotifyLogEvent>();
+    MappedRegion.Reset();
+    MappedFile.Reset();
+    Messages.Empty();
+    Listeners.Empty();
+    OverrideListener.Reset();
+    Header = FMetaSoundNotifyLogHeader();
+    NextEvent = 0;
+}
+
+bool FMetaSoundNotifyReplay::Advance(double InSeconds, int32 InMaxNotifies)
+{
+    if (Events.Num() == 0)
+    {
+        return false;
+    }
+
+    const uint64 FirstCycles = Events[0].Cycles;
+    FMetaSoundNotifyDispatcher& Dispatcher = FMetaSoundNotifyDispatcher::Get();
+    FMetaSoundNotifyRecord Record;
+
+    for (int32 NumSent = 0; NextEvent < Events.Num() && NumSent < InMaxNotifies; ++NumSent)
+    {
+        const FMetaSoundNotifyLogEvent& Event = Events[NextEvent];
+
+        if ((Event.Cycles - FirstCycles) * Header.SecondsPerCycle > InSeconds)
+        {
+            break;
+        }
+
+        // The override gets every notify, even those whose listener was already gone when they were recorded.
+        if (OverrideListener.IsValid())
+        {
+            Record.Listener = FMetaSoundNotifyListener();
+            Record.Listener.Object = OverrideListener;
+        }
+        else
+        {
+            Record.Listener = Listeners.IsValidIndex(Event.ListenerIndex) ? Listeners[Event.ListenerIndex] : FMetaSoundNotifyListener();
+        }
+
+        Record.Type = static_cast<EMetaSoundNotifyType>(Event.Type);
+        Record.NotifyID = Event.NotifyID;
+        Record.IntValue = Event.IntValue;
+        Record.FloatValue = Event.FloatValue;
+        Record.bBoolValue = Event.bBoolValue != 0;
+        Record.Message = Messages.IsValidIndex(Event.MessageIndex) ? Messages[Event.MessageIndex] : FMetaSoundNotifyMessageRef();
+        Record.Bar = Event.Bar;
+        Record.Beat = Event.Beat;
+        Record.SampleIndex = Event.SampleIndex;
+        Record.SampleRate = Event.SampleRate;
+
+        // Not recorded again, recording during a replay only keeps the live notifies.
+        if (!Dispatcher.Enqueue(Record, false))
+        {
+            // Queue full, the notify is sent again on the next advance.
+            break;
+        }
+
+        ++NextEvent;
+    }
+
+    return NextEvent < Events.Num();
+}
+
+double FMetaSoundNotifyReplay::GetDuration() const
+{
+    return Events.Num() > 0 ? (Events.Last().Cycles - Events[0].Cycles) * Header.SecondsPerCycle : 0.0;
+}
+
+namespace MetaSoundNotifyReplay
+{
+    // Replay driven by the console commands, advanced by the core ticker.
+    TUniquePtr<FMetaSoundNotifyReplay> ConsoleReplay;
+    FTSTicker::FDelegateHandle ConsoleReplayTicker;
+    double ConsoleReplayTime = 0.0;
+    double ConsoleReplaySpeed = 1.0;
+
+    bool TickConsoleReplay(float DeltaTime)
+    {
+        ConsoleReplayTime += DeltaTime * ConsoleReplaySpeed;
+
+        if (ConsoleReplay->Advance(ConsoleReplayTime))
+        {
+            return true;
+        }
+
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Notify replay done, %lld notifies sent."), ConsoleReplay->GetNumSent());
+        ConsoleReplay.Reset();
+        ConsoleReplayTicker.Reset();
+        return false;
+    }
+}
+
+void FMetaSoundNotifyReplay::StopConsoleReplay()
+{
+    using namespace MetaSoundNotifyReplay;
+
+    if (ConsoleReplayTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ConsoleReplayTicker);
+        ConsoleReplayTicker.Reset();
+    }
+
+    ConsoleReplay.Reset();
+}
+
+static FAutoConsoleCommand CmdMetaSoundNotifyRecord(
+    TEXT("au.MetaSoundNotify.Record"),
+    TEXT("Records every notify sent into a binary log. Usage: au.MetaSoundNotify.Record <file>"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogMetaSoundNotify, Error, TEXT("Usage: au.MetaSoundNotify.Record <file>"));
+            return;
+        }
+
+        FMetaSoundNotifyRecorder::Get().Start(Args[0]);
+    }));
+
+static FAutoConsoleCommand CmdMetaSoundNotifyStopRecording(
+    TEXT("au.MetaSoundNotify.StopRecording"),
+    TEXT("Stops recording notifies and finishes the log."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        FMetaSoundNotifyRecorder::Get().Stop();
+    }));
+
+static FAutoConsoleCommand CmdMetaSoundNotifyReplay(
+    TEXT("au.MetaSoundNotify.Replay"),
+    TEXT("Sends the notifies of a log again, at the rate they were recorded. Usage: au.MetaSoundNotify.Replay <file> [speed]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        using namespace MetaSoundNotifyReplay;
+
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogMetaSoundNotify, Error, TEXT("Usage: au.MetaSoundNotify.Replay <file> [speed]"));
+            return;
+        }
+
+        FMetaSoundNotifyReplay::StopConsoleReplay();
+
+        TUniquePtr<FMetaSoundNotifyReplay> Replay = MakeUnique<FMetaSoundNotifyReplay>();
+        if (!Replay->Open(Args[0]))
+        {
+            return;
+        }
+
+        ConsoleReplay = MoveTemp(Replay);
+        ConsoleReplayTime = 0.0;
+        ConsoleReplaySpeed = Args.Num() > 1 ? FMath::Max(FCString::Atod(*Args[1]), 0.01) : 1.0;
+        ConsoleReplayTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickConsoleReplay));
+
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Replaying %lld notifies over %.2f seconds."), ConsoleReplay->GetNumEvents(), ConsoleReplay->GetDuration() / ConsoleReplaySpeed);
+    }));
+
+static FAutoConsoleCommand CmdMetaSoundNotifyStopReplay(
+    TEXT("au.MetaSoundNotify.StopReplay"),
+    TEXT("Stops the notify replay."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        FMetaSoundNotifyReplay::StopConsoleReplay();
+    }));
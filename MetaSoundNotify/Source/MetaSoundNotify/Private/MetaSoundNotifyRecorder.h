@@ -0,0 +1,192 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyRingBuffer.h"
+#include <atomic>
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * @name FMetaSoundNotifyLogHeader
+ * @brief Start of a notify log file. The header is followed by NumEvents FMetaSoundNotifyLogEvent, then by the string
+ * table: NumMessages messages and NumListeners listener addresses, each one a uint32 byte count followed by UTF-8.
+ * Everything has a fixed size and is 8 bytes aligned, so the events can be read in place from a memory mapping.
+ */
+struct FMetaSoundNotifyLogHeader
+{
+    static constexpr uint32 MagicNumber = 0x524E534D; // "MSNR"
+    static constexpr uint32 CurrentVersion = 1;
+
+    uint32 Magic = MagicNumber;
+    uint32 Version = CurrentVersion;
+    uint64 NumEvents = 0;
+    uint64 EventsOffset = 0;
+    uint64 StringsOffset = 0;
+    uint32 NumMessages = 0;
+    uint32 NumListeners = 0;
+    // Converts the capture times of the events into seconds.
+    double SecondsPerCycle = 0.0;
+};
+
+/**
+ * @name FMetaSoundNotifyLogEvent
+ * @brief One recorded notify. Strings are indices into the string table of the log, INDEX_NONE when there is none.
+ */
+struct FMetaSoundNotifyLogEvent
+{
+    // When the notify was sent, in FPlatformTime cycles.
+    uint64 Cycles = 0;
+    int64 SampleIndex = 0;
+    float SampleRate = 0.0f;
+    float FloatValue = 0.0f;
+    int32 NotifyID = 0;
+    int32 IntValue = 0;
+    int32 Bar = 0;
+    int32 Beat = 0;
+    int32 MessageIndex = INDEX_NONE;
+    int32 ListenerIndex = INDEX_NONE;
+    uint8 Type = 0;
+    uint8 bBoolValue = 0;
+    uint8 Padding[6] = {};
+};
+
+static_assert(sizeof(FMetaSoundNotifyLogHeader) == 48, "The notify log header layout changed, bump its version.");
+static_assert(sizeof(FMetaSoundNotifyLogEvent) == 56, "The notify log event layout changed, bump the log version.");
+
+/**
+ * @name FMetaSoundNotifyRecorder
+ * @brief Records every notify sent into a binary log, to reproduce desyncs offline and load test listeners.
+ * Every thread sending notifies gets its own lock-free buffer, so recording adds no contention to the render threads.
+ * The game thread flushes the buffers into the log on every tick. Snapshot samples are not recorded.
+ */
+class FMetaSoundNotifyRecorder
+{
+public:
+    static FMetaSoundNotifyRecorder& Get();
+
+    ~FMetaSoundNotifyRecorder();
+
+    /** Starts recording into a new log file. Game thread only. */
+    bool Start(const FString& InFilename);
+
+    /** Flushes what is left and finishes the log. Game thread only. */
+    void Stop();
+
+    bool IsRecording() const
+    {
+        return bRecording.load(std::memory_order_relaxed);
+    }
+
+    /** Records a notify. Any thread, only locks the first time a thread records something. */
+    void Capture(const FMetaSoundNotifyRecord& InRecord);
+
+private:
+    FMetaSoundNotifyRecorder() = default;
+
+    struct FCapturedNotify
+    {
+        FMetaSoundNotifyRecord Record;
+        uint64 Cycles = 0;
+    };
+
+    static constexpr uint32 ThreadBufferCapacity = 4096;
+
+    struct FThreadBuffer
+    {
+        FThreadBuffer()
+        : Notifies(ThreadBufferCapacity)
+        {
+        }
+
+        TMetaSoundNotifyRingBuffer<FCapturedNotify> Notifies;
+    };
+
+    FThreadBuffer& GetThreadBuffer();
+    bool Tick(float DeltaTime);
+    void Flush();
+    int32 GetMessageIndex(const FMetaSoundNotifyMessageRef& InMessage);
+    int32 GetListenerIndex(const FMetaSoundNotifyListener& InListener, const UMetaSoundNotifySubsystem* InSubsystem);
+    int32 AddListener(const FString& InAddress);
+
+    std::atomic<bool> bRecording{ false };
+    std::atomic<uint32> NumDropped{ 0 };
+
+    // Buffers of every thread that ever recorded. Never freed before the recorder, threads keep a pointer to theirs.
+    FCriticalSection ThreadBuffersLock;
+    TArray<TUniquePtr<FThreadBuffer>> ThreadBuffers;
+
+    TUniquePtr<FArchive> Writer;
+    FMetaSoundNotifyLogHeader Header;
+
+    // String table, interned on the text. Messages are not kept past the flush that wrote them: nodes reuse their
+    // buffers once delivered, so neither their lifetime nor their address identifies a string.
+    TArray<FString> Messages;
+    TMap<FString, int32> MessageIndices;
+    TArray<FString> Listeners;
+    TMap<FString, int32> ListenerIndices;
+    TMap<FName, int32> GroupListenerIndices;
+    // Listener objects already seen during a flush. Only valid for that flush, objects may be collected afterwards.
+    TMap<UObject*, int32> ObjectListenerIndices;
+
+    // Scratch arrays reused by every flush.
+    FCapturedNotify Pending;
+    TArray<FCapturedNotify> Captured;
+    TArray<FMetaSoundNotifyLogEvent> Events;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+};
+
+/**
+ * @name FMetaSoundNotifyReplay
+ * @brief Plays a notify log back through the dispatcher, at the rate it was recorded or as fast as wanted, without any
+ * audio running. The events are read in place from a memory mapping of the log.
+ */
+class FMetaSoundNotifyReplay
+{
+public:
+    ~FMetaSoundNotifyReplay();
+
+    /**
+     * Opens a log. Every notify goes to its recorded listener, or to InListener if set.
+     * Recorded listeners are resolved once here, so they must exist already. Game thread only.
+     */
+    bool Open(const FString& InFilename, UObject* InListener = nullptr);
+
+    void Close();
+
+    /**
+     * Sends every notify recorded up to InSeconds after the first one, at most InMaxNotifies of them.
+     * Returns false once the whole log was sent.
+     */
+    bool Advance(double InSeconds, int32 InMaxNotifies = FMetaSoundNotifyDispatcher::QueueCapacity);
+
+    int64 GetNumEvents() const
+    {
+        return Events.Num();
+    }
+
+    int64 GetNumSent() const
+    {
+        return NextEvent;
+    }
+
+    /** Time between the first and the last notify of the log, in seconds. */
+    double GetDuration() const;
+
+    /** Stops the replay started by au.MetaSoundNotify.Replay, if any. */
+    static void StopConsoleReplay();
+
+private:
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    FMetaSoundNotifyLogHeader Header;
+    TArrayView64<const FMetaSoundNotifyLogEvent> Events;
+    TArray<FMetaSoundNotifyMessageRef> Messages;
+    TArray<FMetaSoundNotifyListener> Listeners;
+    FWeakObjectPtr OverrideListener;
+    int64 NextEvent = 0;
+};
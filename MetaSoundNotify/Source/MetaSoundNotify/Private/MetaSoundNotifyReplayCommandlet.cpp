@@ -0,0 +1,122 @@
+#include "MetaSoundNotifyReplayCommandlet.h"
+#include "MetaSoundNotify.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyInterface.h"
+#include "MetaSoundNotifyMockListener.h"
+#include "MetaSoundNotifyRecorder.h"
+#include "MetaSoundNotifySubsystem.h"
+
+UMetaSoundNotifyReplayCommandlet::UMetaSoundNotifyReplayCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UMetaSoundNotifyReplayCommandlet::Main(const FString& Params)
+{
+    FString LogPath;
+    FString ListenerClassPath;
+    double Speed = 0.0;
+    int32 FrameRate = 60;
+
+    if (!FParse::Value(*Params, TEXT("Log="), LogPath))
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Usage: -run=MetaSoundNotifyReplay -Log=<file> [-Speed=0] [-FrameRate=60] [-ListenerClass=<Blueprint class path>]"));
+        return 1;
+    }
+
+    FParse::Value(*Params, TEXT("Speed="), Speed);
+    FParse::Value(*Params, TEXT("FrameRate="), FrameRate);
+    FParse::Value(*Params, TEXT("ListenerClass="), ListenerClassPath);
+
+    UMetaSoundNotifySubsystem* Subsystem = UMetaSoundNotifySubsystem::Get();
+    if (!Subsystem)
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("The MetaSound Notify subsystem isn't available."));
+        return 1;
+    }
+
+    UObject* Listener = nullptr;
+    UMetaSoundNotifyMockListener* NativeListener = nullptr;
+
+    if (ListenerClassPath.IsEmpty())
+    {
+        NativeListener = NewObject<UMetaSoundNotifyMockListener>();
+        Subsystem->AddNativeListener(NativeListener, INDEX_NONE, FMetaSoundNotifyNativeDelegate::CreateUObject(NativeListener, &UMetaSoundNotifyMockListener::OnNotify));
+        Listener = NativeListener;
+    }
+    else
+    {
+        UClass* ListenerClass = FSoftClassPath(ListenerClassPath).TryLoadClass<UObject>();
+        if (!ListenerClass || !ListenerClass->ImplementsInterface(UMetaSoundNotifyInterface::StaticClass()))
+        {
+            UE_LOG(LogMetaSoundNotify, Error, TEXT("%s isn't a class implementing the MetaSound Notify interface."), *ListenerClassPath);
+            return 1;
+        }
+
+        Listener = NewObject<UObject>(GetTransientPackage(), ListenerClass);
+    }
+
+    Listener->AddToRoot();
+
+    int32 Result = 0;
+    FMetaSoundNotifyReplay Replay;
+
+    if (Replay.Open(LogPath, Listener))
+    {
+        FMetaSoundNotifyDispatcher& Dispatcher = FMetaSoundNotifyDispatcher::Get();
+        const double FrameSeconds = 1.0 / FMath::Max(FrameRate, 1);
+        const double StartSeconds = FPlatformTime::Seconds();
+        double DrainSeconds = 0.0;
+        bool bSending = true;
+
+        while (bSending)
+        {
+            if (Speed > 0.0)
+            {
+                // Paced like a game: sleep until the next frame, then send what was recorded in the meantime.
+                const double FrameEndSeconds = StartSeconds + FMath::FloorToDouble((FPlatformTime::Seconds() - StartSeconds) / FrameSeconds + 1.0) * FrameSeconds;
+                FPlatformProcess::SleepNoStats(FMath::Max(FrameEndSeconds - FPlatformTime::Seconds(), 0.0));
+                bSending = Replay.Advance((FPlatformTime::Seconds() - StartSeconds) * Speed);
+            }
+            else
+            {
+                // As fast as possible, one full queue at a time.
+                bSending = Replay.Advance(TNumericLimits<double>::Max());
+            }
+
+            const double DrainStartSeconds = FPlatformTime::Seconds();
+            Dispatcher.Drain();
+            DrainSeconds += FPlatformTime::Seconds() - DrainStartSeconds;
+        }
+
+        const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+        const int64 NumSent = Replay.GetNumSent();
+
+        UE_LOG(LogMetaSoundNotify, Display, TEXT("Replayed %lld notifies recorded over %.2f s in %.3f s: %.0f notifies/s, %.1f ns of drain per notify."),
+            NumSent, Replay.GetDuration(), ElapsedSeconds,
+            ElapsedSeconds > 0.0 ? NumSent / ElapsedSeconds : 0.0,
+            NumSent > 0 ? DrainSeconds * 1e9 / NumSent : 0.0);
+
+        if (NativeListener && NativeListener->NumReceived != NumSent)
+        {
+            UE_LOG(LogMetaSoundNotify, Error, TEXT("Sent %lld notifies but the listener received %lld."), NumSent, NativeListener->NumReceived);
+            Result = 1;
+        }
+    }
+    else
+    {
+        Result = 1;
+    }
+
+    if (NativeListener)
+    {
+        Subsystem->RemoveNativeListeners(NativeListener);
+    }
+
+    Listener->RemoveFromRoot();
+
+    return Result;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include <atomic>
+
+/**
+ * @name TMetaSoundNotifyRingBuffer
+ * @brief Bounded lock-free queue with many producers and a single consumer.
+ * Every cell is allocated up front, so pushing never allocates. Any thread can push (MetaSound generators may render
+ * in parallel), but only one thread at a time is allowed to pop.
+ */
+template<typename ElementType>
+class TMetaSoundNotifyRingBuffer
+{
+public:
+    explicit TMetaSoundNotifyRingBuffer(uint32 InCapacity)
+    {
+        const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+
+        Cells = MakeUnique<FCell[]>(Capacity);
+        Mask = Capacity - 1;
+
+        for (uint32 Index = 0; Index < Capacity; ++Index)
+        {
+            Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+        }
+    }
+
+    uint32 GetCapacity() const
+    {
+        return Mask + 1;
+    }
+
+    /** Copies the element into the next free cell. Returns false if the queue is full. */
+    bool Push(const ElementType& InElement)
+    {
+        uint32 Position = EnqueuePosition.load(std::memory_order_relaxed);
+        FCell* Cell = nullptr;
+
+        for (;;)
+        {
+            Cell = &Cells[Position & Mask];
+            const uint32 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const int32 Difference = static_cast<int32>(Sequence - Position);
+
+            if (Difference == 0)
+            {
+                if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                Position = EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        Cell->Element = InElement;
+        Cell->Sequence.store(Position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /** Moves the oldest element out. Consumer side only. Returns false if the queue is empty. */
+    bool Pop(ElementType& OutElement)
+    {
+        FCell& Cell = Cells[DequeuePosition & Mask];
+        const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+
+        if (static_cast<int32>(Sequence - (DequeuePosition + 1)) < 0)
+        {
+            return false;
+        }
+
+        OutElement = MoveTemp(Cell.Element);
+        Cell.Sequence.store(DequeuePosition + Mask + 1, std::memory_order_release);
+        ++DequeuePosition;
+
+        return true;
+    }
+
+private:
+    struct FCell
+    {
+        std::atomic<uint32> Sequence;
+        ElementType Element;
+    };
+
+    TUniquePtr<FCell[]> Cells;
+    uint32 Mask = 0;
+
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> EnqueuePosition{ 0 };
+    alignas(PLATFORM_CACHE_LINE_SIZE) uint32 DequeuePosition = 0;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("MetaSound Notify"), STATGROUP_MetaSoundNotify, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Notify Operators Execute"), STAT_MetaSoundNotifyExecute, STATGROUP_MetaSoundNotify, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Notify Operators Send"), STAT_MetaSoundNotifySend, STATGROUP_MetaSoundNotify, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Drain"), STAT_MetaSoundNotifyDrain, STATGROUP_MetaSoundNotify, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sends"), STAT_MetaSoundNotifySends, STATGROUP_MetaSoundNotify, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Failed Resolves"), STAT_MetaSoundNotifyFailedResolves, STATGROUP_MetaSoundNotify, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Interface Misses"), STAT_MetaSoundNotifyInterfaceMisses, STATGROUP_MetaSoundNotify, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Listener Class Cache Hits"), STAT_MetaSoundNotifyClassCacheHits, STATGROUP_MetaSoundNotify, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Listener Class Cache Misses"), STAT_MetaSoundNotifyClassCacheMisses, STATGROUP_MetaSoundNotify, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Notifies"), STAT_MetaSoundNotifyDeferred, STATGROUP_MetaSoundNotify, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Late Notifies"), STAT_MetaSoundNotifyLate, STATGROUP_MetaSoundNotify, );
@@ -0,0 +1,301 @@
+#include "MetaSoundNotifySubsystem.h"
+#include "MetaSoundNotify.h"
+#include "Engine/Engine.h"
+#include "UObject/UObjectGlobals.h"
+
+UMetaSoundNotifySubsystem* UMetaSoundNotifySubsystem::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UMetaSoundNotifySubsystem>() : nullptr;
+}
+
+void UMetaSoundNotifySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UMetaSoundNotifySubsystem::ReleaseDestroyedListeners);
+}
+
+void UMetaSoundNotifySubsystem::Deinitialize()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+    PostGarbageCollectHandle.Reset();
+
+    Slots.Reset();
+    FreeSlots.Reset();
+    ListenerHandles.Reset();
+    Groups.Reset();
+    NativeListeners.Reset();
+    PendingNativeChanges.Reset();
+
+    Super::Deinitialize();
+}
+
+int32 UMetaSoundNotifySubsystem::RegisterListener(UObject* Listener)
+{
+    check(IsInGameThread());
+
+    if (!Listener)
+    {
+        return 0;
+    }
+
+    if (const int32* ExistingHandle = ListenerHandles.Find(Listener))
+    {
+        return *ExistingHandle;
+    }
+
+    int32 SlotIndex = INDEX_NONE;
+    if (FreeSlots.Num() > 0)
+    {
+        SlotIndex = FreeSlots.Pop(false);
+    }
+    else if (Slots.Num() < MaxSlots)
+    {
+        SlotIndex = Slots.AddDefaulted();
+    }
+    else
+    {
+        UE_LOG(LogMetaSoundNotify, Error, TEXT("Can't register %s, all %d listener slots are in use."), *GetNameSafe(Listener), MaxSlots);
+        return 0;
+    }
+
+    FListenerSlot& Slot = Slots[SlotIndex];
+    Slot.Listener = Listener;
+    Slot.bInUse = true;
+
+    const int32 Handle = MakeHandle(SlotIndex, Slot.Generation);
+    ListenerHandles.Add(Listener, Handle);
+
+    return Handle;
+}
+
+void UMetaSoundNotifySubsystem::UnregisterListener(int32 Handle)
+{
+    check(IsInGameThread());
+
+    if (!FindSlot(Handle))
+    {
+        return;
+    }
+
+    const int32 SlotIndex = (Handle & IndexMask) - 1;
+    ListenerHandles.Remove(Slots[SlotIndex].Listener);
+    ReleaseSlot(SlotIndex);
+}
+
+void UMetaSoundNotifySubsystem::ReleaseSlot(int32 SlotIndex)
+{
+    FListenerSlot& Slot = Slots[SlotIndex];
+
+    Slot.Listener.Reset();
+    Slot.bInUse = false;
+    // Bump the generation so any copy of this handle left in a graph stops resolving.
+    Slot.Generation = (Slot.Generation + 1) & GenerationMask;
+    FreeSlots.Add(SlotIndex);
+}
+
+void UMetaSoundNotifySubsystem::ReleaseDestroyedListeners()
+{
+    for (auto It = ListenerHandles.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+    {
+        if (Slots[SlotIndex].bInUse && !Slots[SlotIndex].Listener.IsValid())
+        {
+            ReleaseSlot(SlotIndex);
+        }
+    }
+
+    for (TPair<FName, TArray<TWeakObjectPtr<UObject>>>& Group : Groups)
+    {
+        Group.Value.RemoveAllSwap([](const TWeakObjectPtr<UObject>& Member) { return !Member.IsValid(); }, false);
+    }
+
+    // Bindings are only iterated while their delegates run, which a garbage collection never interrupts.
+    if (!bExecutingNativeListener)
+    {
+        for (auto It = NativeListeners.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().ResolveObjectPtr())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+}
+
+UObject* UMetaSoundNotifySubsystem::GetListener(int32 Handle) const
+{
+    const FListenerSlot* Slot = FindSlot(Handle);
+    return Slot ? Slot->Listener.Get() : nullptr;
+}
+
+void UMetaSoundNotifySubsystem::JoinGroup(FName Group, UObject* Listener)
+{
+    check(IsInGameThread());
+
+    if (Group.IsNone() || !Listener)
+    {
+        return;
+    }
+
+    TArray<TWeakObjectPtr<UObject>>& Members = Groups.FindOrAdd(Group);
+
+    // Drop members that were destroyed without leaving, so the group doesn't grow forever.
+    Members.RemoveAllSwap([](const TWeakObjectPtr<UObject>& Member) { return !Member.IsValid(); }, false);
+    Members.AddUnique(Listener);
+}
+
+void UMetaSoundNotifySubsystem::LeaveGroup(FName Group, UObject* Listener)
+{
+    check(IsInGameThread());
+
+    if (TArray<TWeakObjectPtr<UObject>>* Members = Groups.Find(Group))
+    {
+        Members->RemoveSingleSwap(Listener, false);
+    }
+}
+
+const TArray<TWeakObjectPtr<UObject>>* UMetaSoundNotifySubsystem::FindGroupMembers(FName Group) const
+{
+    return Groups.Find(Group);
+}
+
+FDelegateHandle UMetaSoundNotifySubsystem::AddNativeListener(UObject* Listener, int32 NotifyID, FMetaSoundNotifyNativeDelegate Delegate)
+{
+    check(IsInGameThread());
+
+    if (!Listener || !Delegate.IsBound())
+    {
+        return FDelegateHandle();
+    }
+
+    const FDelegateHandle Handle = Delegate.GetHandle();
+    ApplyNativeChange({ FObjectKey(Listener), Handle, { NotifyID, MoveTemp(Delegate) } });
+    return Handle;
+}
+
+void UMetaSoundNotifySubsystem::RemoveNativeListener(UObject* Listener, FDelegateHandle Handle)
+{
+    check(IsInGameThread());
+
+    if (Handle.IsValid())
+    {
+        ApplyNativeChange({ FObjectKey(Listener), Handle, {} });
+    }
+}
+
+void UMetaSoundNotifySubsystem::RemoveNativeListeners(UObject* Listener)
+{
+    check(IsInGameThread());
+
+    ApplyNativeChange({ FObjectKey(Listener), FDelegateHandle(), {} });
+}
+
+bool UMetaSoundNotifySubsystem::HasNativeListener(const UObject* Listener, int32 NotifyID) const
+{
+    if (NativeListeners.Num() == 0)
+    {
+        return false;
+    }
+
+    const TArray<FNativeBinding>* Bindings = NativeListeners.Find(FObjectKey(Listener));
+    if (!Bindings)
+    {
+        return false;
+    }
+
+    return Bindings->ContainsByPredicate([NotifyID](const FNativeBinding& Binding) { return Binding.NotifyID == INDEX_NONE || Binding.NotifyID == NotifyID; });
+}
+
+void UMetaSoundNotifySubsystem::ExecuteNativeListener(const UObject* Listener, const FMetaSoundNotifyEvent& Event)
+{
+    check(IsInGameThread());
+
+    const TArray<FNativeBinding>* Bindings = NativeListeners.Find(FObjectKey(Listener));
+    if (!Bindings)
+    {
+        return;
+    }
+
+    {
+        // Bindings stay put while their delegates run, changes they make are applied afterwards.
+        TGuardValue<bool> ExecutingGuard(bExecutingNativeListener, true);
+
+        for (const FNativeBinding& Binding : *Bindings)
+        {
+            if (Binding.NotifyID == INDEX_NONE || Binding.NotifyID == Event.NotifyID)
+            {
+                Binding.Delegate.ExecuteIfBound(Event);
+            }
+        }
+    }
+
+    if (PendingNativeChanges.Num() > 0 && !bExecutingNativeListener)
+    {
+        TArray<FPendingNativeChange> Changes = MoveTemp(PendingNativeChanges);
+        for (FPendingNativeChange& Change : Changes)
+        {
+            ApplyNativeChange(MoveTemp(Change));
+        }
+    }
+}
+
+void UMetaSoundNotifySubsystem::ApplyNativeChange(FPendingNativeChange&& Change)
+{
+    if (bExecutingNativeListener)
+    {
+        PendingNativeChanges.Add(MoveTemp(Change));
+        return;
+    }
+
+    if (Change.Binding.Delegate.IsBound())
+    {
+        NativeListeners.FindOrAdd(Change.Listener).Add(MoveTemp(Change.Binding));
+        return;
+    }
+
+    TArray<FNativeBinding>* Bindings = NativeListeners.Find(Change.Listener);
+    if (!Bindings)
+    {
+        return;
+    }
+
+    if (Change.Handle.IsValid())
+    {
+        Bindings->RemoveAll([&Change](const FNativeBinding& Binding) { return Binding.Delegate.GetHandle() == Change.Handle; });
+    }
+    else
+    {
+        Bindings->Reset();
+    }
+
+    if (Bindings->Num() == 0)
+    {
+        NativeListeners.Remove(Change.Listener);
+    }
+}
+
+int32 UMetaSoundNotifySubsystem::MakeHandle(int32 SlotIndex, uint16 Generation)
+{
+    return (static_cast<int32>(Generation) << IndexBits) | (SlotIndex + 1);
+}
+
+const UMetaSoundNotifySubsystem::FListenerSlot* UMetaSoundNotifySubsystem::FindSlot(int32 Handle) const
+{
+    const int32 SlotIndex = (Handle & IndexMask) - 1;
+
+    if (Handle <= 0 || !Slots.IsValidIndex(SlotIndex))
+    {
+        return nullptr;
+    }
+
+    const FListenerSlot& Slot = Slots[SlotIndex];
+    return Slot.Generation == ((Handle >> IndexBits) & GenerationMask) ? &Slot : nullptr;
+}
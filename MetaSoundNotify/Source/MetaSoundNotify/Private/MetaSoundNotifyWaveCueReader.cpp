@@ -0,0 +1,138 @@
+#include "MetaSoundNotifyWaveCueReader.h"
+#include "Misc/FileHelper.h"
+
+namespace MetaSoundNotifyWaveCueReader
+{
+    uint32 ReadUInt32(const uint8* InData)
+    {
+        // RIFF is little endian.
+        return uint32(InData[0]) | (uint32(InData[1]) << 8) | (uint32(InData[2]) << 16) | (uint32(InData[3]) << 24);
+    }
+
+    bool IsChunk(const uint8* InData, const char* InID)
+    {
+        return FMemory::Memcmp(InData, InID, 4) == 0;
+    }
+
+    void ReadLabels(const uint8* InData, uint32 InSize, TMap<int32, FString>& OutLabels)
+    {
+        // Sub-chunks of an "adtl" list: "labl" holds a cue ID followed by a null terminated string.
+        uint32 Offset = 4;
+        while (Offset + 8 <= InSize)
+        {
+            const uint8* SubChunk = InData + Offset;
+            const uint32 SubChunkSize = ReadUInt32(SubChunk + 4);
+
+            // Compared against what is left, so a huge size can't wrap around.
+            if (SubChunkSize > InSize - Offset - 8)
+            {
+                break;
+            }
+
+            if (IsChunk(SubChunk, "labl") && SubChunkSize >= 4)
+            {
+                const int32 CueID = static_cast<int32>(ReadUInt32(SubChunk + 8));
+                const ANSICHAR* Text = reinterpret_cast<const ANSICHAR*>(SubChunk + 12);
+                const int32 MaxLength = static_cast<int32>(SubChunkSize - 4);
+
+                int32 TextLength = 0;
+                while (TextLength < MaxLength && Text[TextLength] != '\0')
+                {
+                    ++TextLength;
+                }
+
+                OutLabels.Add(CueID, FString(TextLength, Text));
+            }
+
+            // Chunks are padded to an even size.
+            Offset += 8 + SubChunkSize + (SubChunkSize & 1);
+        }
+    }
+}
+
+bool FMetaSoundNotifyWaveCueReader::Read(TArrayView<const uint8> InData, FMetaSoundNotifyWaveCues& OutCues, FString& OutError)
+{
+    using namespace MetaSoundNotifyWaveCueReader;
+
+    OutCues = FMetaSoundNotifyWaveCues();
+
+    const uint8* Data = InData.GetData();
+    const uint32 Size = static_cast<uint32>(InData.Num());
+
+    if (Size < 12 || !IsChunk(Data, "RIFF") || !IsChunk(Data + 8, "WAVE"))
+    {
+        OutError = TEXT("Not a RIFF WAVE file.");
+        return false;
+    }
+
+    TMap<int32, FString> LabelsByCueID;
+    uint32 Offset = 12;
+
+    while (Offset + 8 <= Size)
+    {
+        const uint8* Chunk = Data + Offset;
+        const uint32 ChunkSize = ReadUInt32(Chunk + 4);
+        const uint8* ChunkData = Chunk + 8;
+
+        // Compared against what is left, so a huge size can't wrap around.
+        if (ChunkSize > Size - Offset - 8)
+        {
+            // Truncated file, keep what we got so far.
+            break;
+        }
+
+        if (IsChunk(Chunk, "fmt ") && ChunkSize >= 8)
+        {
+            OutCues.SampleRate = static_cast<int32>(ReadUInt32(ChunkData + 4));
+        }
+        else if (IsChunk(Chunk, "cue ") && ChunkSize >= 4)
+        {
+            // Every cue point is 24 bytes: ID, position, data chunk ID, chunk start, block start, sample offset.
+            const uint32 NumCues = FMath::Min(ReadUInt32(ChunkData), (ChunkSize - 4) / 24);
+            OutCues.Cues.Reserve(NumCues);
+
+            for (uint32 CueIndex = 0; CueIndex < NumCues; ++CueIndex)
+            {
+                const uint8* CueData = ChunkData + 4 + CueIndex * 24;
+
+                FMetaSoundNotifyWaveCues::FCue& Cue = OutCues.Cues.AddDefaulted_GetRef();
+                Cue.ID = static_cast<int32>(ReadUInt32(CueData));
+                Cue.SampleOffset = static_cast<int32>(ReadUInt32(CueData + 20));
+            }
+        }
+        else if (IsChunk(Chunk, "LIST") && ChunkSize >= 4 && IsChunk(ChunkData, "adtl"))
+        {
+            ReadLabels(ChunkData, ChunkSize, LabelsByCueID);
+        }
+
+        Offset += 8 + ChunkSize + (ChunkSize & 1);
+    }
+
+    for (FMetaSoundNotifyWaveCues::FCue& Cue : OutCues.Cues)
+    {
+        if (FString* Label = LabelsByCueID.Find(Cue.ID))
+        {
+            Cue.Label = MoveTemp(*Label);
+        }
+    }
+
+    if (OutCues.SampleRate <= 0)
+    {
+        OutError = TEXT("Missing or invalid fmt chunk.");
+        return false;
+    }
+
+    return true;
+}
+
+bool FMetaSoundNotifyWaveCueReader::ReadFile(const FString& InFilename, FMetaSoundNotifyWaveCues& OutCues, FString& OutError)
+{
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *InFilename))
+    {
+        OutError = FString::Printf(TEXT("Can't read %s."), *InFilename);
+        return false;
+    }
+
+    return Read(FileData, OutCues, OutError);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @name FMetaSoundNotifyWaveCues
+ * @brief Cue points found in a WAV file, in file order.
+ */
+struct FMetaSoundNotifyWaveCues
+{
+    struct FCue
+    {
+        int32 ID = 0;
+        int32 SampleOffset = 0;
+        FString Label;
+    };
+
+    int32 SampleRate = 0;
+    TArray<FCue> Cues;
+};
+
+/**
+ * @name FMetaSoundNotifyWaveCueReader
+ * @brief Minimal RIFF reader for the "fmt ", "cue " and "LIST"/"adtl" chunks of a WAV file. Audio data is skipped.
+ */
+class FMetaSoundNotifyWaveCueReader
+{
+public:
+    static bool Read(TArrayView<const uint8> InData, FMetaSoundNotifyWaveCues& OutCues, FString& OutError);
+    static bool ReadFile(const FString& InFilename, FMetaSoundNotifyWaveCues& OutCues, FString& OutError);
+};
@@ -0,0 +1,62 @@
+#include "Misc/AutomationTest.h"
+#include "MetaSoundNotifyOperatorHarness.h"
+#include "MetaSoundNotifyTestListener.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaSoundNotifyBeatGridLoopTest, "MetaSoundNotify.BeatGrid.Loop", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundNotifyBeatGridLoopTest::RunTest(const FString& Parameters)
+{
+    FMetaSoundNotifyTestListener Listener;
+    if (!TestTrue(TEXT("Subsystem available"), Listener.IsValid()))
+    {
+        return false;
+    }
+
+    // One bar of 4/4 at 120 BPM looped three times, 100 blocks per second, wrapping in the middle of a block.
+    const Metasound::FOperatorSettings Settings(48000.0f, 100.0f);
+    const double LoopSeconds = 2.0;
+    const double BlockSeconds = 0.01;
+    const double PhaseSeconds = 0.005;
+    const int32 NumLoops = 3;
+
+    FMetaSoundNotifyOperatorHarness Harness(Settings);
+    if (!TestTrue(TEXT("Node registered"), Harness.CreateNode({ TEXT("UE"), TEXT("NotifyBeatGrid"), TEXT("Notify Beat Grid") }, 1, 0)))
+    {
+        return false;
+    }
+
+    Harness.AddInput<int32>(TEXT("Listener Handle"), Listener.GetHandle());
+    Metasound::TDataWriteReference<float> Playback = Harness.AddInput<float>(TEXT("Playback Time"), 0.0f);
+
+    if (!TestTrue(TEXT("Operator created"), Harness.CreateOperator()))
+    {
+        return false;
+    }
+
+    const int32 NumBlocks = FMath::RoundToInt(NumLoops * LoopSeconds / BlockSeconds);
+    for (int32 Block = 0; Block < NumBlocks; ++Block)
+    {
+        *Playback = static_cast<float>(FMath::Fmod(Block * BlockSeconds + PhaseSeconds, LoopSeconds));
+        Harness.Execute();
+    }
+
+    Listener.Drain();
+
+    // The first block starts after the first downbeat, every later pass starts with the downbeat at the loop point.
+    const TArray<int32> Expected = { 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 };
+
+    if (TestEqual(TEXT("Number of beats sent"), Listener.Events.Num(), Expected.Num()))
+    {
+        for (int32 Index = 0; Index < Expected.Num(); ++Index)
+        {
+            TestEqual(FString::Printf(TEXT("Beat %d"), Index), Listener.Events[Index].Beat, Expected[Index]);
+            TestEqual(FString::Printf(TEXT("Bar of beat %d"), Index), Listener.Events[Index].Bar, 0);
+        }
+    }
+
+    return true;
+}
+
+#endif
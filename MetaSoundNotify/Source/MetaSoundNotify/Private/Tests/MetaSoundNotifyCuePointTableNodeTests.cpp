@@ -0,0 +1,66 @@
+#include "Misc/AutomationTest.h"
+#include "MetaSoundNotifyOperatorHarness.h"
+#include "MetaSoundNotifyTestListener.h"
+#include "MetasoundPrimitives.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaSoundNotifyCuePointTableLoopTest, "MetaSoundNotify.CuePointTable.Loop", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundNotifyCuePointTableLoopTest::RunTest(const FString& Parameters)
+{
+    FMetaSoundNotifyTestListener Listener;
+    if (!TestTrue(TEXT("Subsystem available"), Listener.IsValid()))
+    {
+        return false;
+    }
+
+    // 100 blocks per second, a one second loop wrapping in the middle of a block.
+    const Metasound::FOperatorSettings Settings(48000.0f, 100.0f);
+    const double LoopSeconds = 1.0;
+    const double BlockSeconds = 0.01;
+    const double PhaseSeconds = 0.003;
+    const int32 NumLoops = 3;
+
+    FMetaSoundNotifyOperatorHarness Harness(Settings);
+    if (!TestTrue(TEXT("Node registered"), Harness.CreateNode({ TEXT("UE"), TEXT("NotifyCuePointTable"), TEXT("Notify Cue Point Table") }, 1, 0)))
+    {
+        return false;
+    }
+
+    // Right at the loop start, in the middle, and in the tail crossed by the block that wraps.
+    const TArray<float> Positions = { 0.0f, 0.5f, 0.995f };
+
+    Harness.AddInput<int32>(TEXT("Listener Handle"), Listener.GetHandle());
+    Harness.AddInput<TArray<float>>(TEXT("Cue Point Positions"), Positions);
+    Metasound::TDataWriteReference<float> Playback = Harness.AddInput<float>(TEXT("Playback Position"), 0.0f);
+
+    if (!TestTrue(TEXT("Operator created"), Harness.CreateOperator()))
+    {
+        return false;
+    }
+
+    const int32 NumBlocks = FMath::RoundToInt(NumLoops * LoopSeconds / BlockSeconds);
+    for (int32 Block = 0; Block < NumBlocks; ++Block)
+    {
+        *Playback = static_cast<float>(FMath::Fmod((Block + 1) * BlockSeconds + PhaseSeconds, LoopSeconds));
+        Harness.Execute();
+    }
+
+    Listener.Drain();
+
+    // The first pass plus one per wrap for the loop start, once per loop for the others, in playback order.
+    const TArray<int32> Expected = { 0, 1, 2, 0, 1, 2, 0, 1, 2, 0 };
+
+    if (TestEqual(TEXT("Number of cue points sent"), Listener.Events.Num(), Expected.Num()))
+    {
+        for (int32 Index = 0; Index < Expected.Num(); ++Index)
+        {
+            TestEqual(FString::Printf(TEXT("Cue point %d"), Index), Listener.Events[Index].IntValue, Expected[Index]);
+        }
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,83 @@
+#include "Misc/AutomationTest.h"
+#include "MetaSoundNotifyOperatorHarness.h"
+#include "MetaSoundNotifyTestListener.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MetaSoundNotifyRawCuePointNodeTests
+{
+    // Loops a one second sound three times, 100 blocks per second, wrapping in the middle of a block. Returns the loop
+    // iteration of every notify the node sent.
+    TArray<int32> RunLoops(FAutomationTestBase& Test, float InCuePoint)
+    {
+        TArray<int32> Iterations;
+
+        FMetaSoundNotifyTestListener Listener;
+        if (!Test.TestTrue(TEXT("Subsystem available"), Listener.IsValid()))
+        {
+            return Iterations;
+        }
+
+        const Metasound::FOperatorSettings Settings(48000.0f, 100.0f);
+        const double LoopSeconds = 1.0;
+        const double BlockSeconds = 0.01;
+        const double PhaseSeconds = 0.003;
+        const int32 NumLoops = 3;
+
+        FMetaSoundNotifyOperatorHarness Harness(Settings);
+        if (!Test.TestTrue(TEXT("Node registered"), Harness.CreateNode({ TEXT("UE"), TEXT("NotifyRawCuePoint"), TEXT("Notify Raw Cue Point") }, 1, 2)))
+        {
+            return Iterations;
+        }
+
+        Harness.AddInput<int32>(TEXT("Listener Handle"), Listener.GetHandle());
+        Harness.AddInput<float>(TEXT("Cue Point Position"), InCuePoint);
+        Harness.AddInput<bool>(TEXT("Start Listening"), true);
+        Metasound::TDataWriteReference<float> Playback = Harness.AddInput<float>(TEXT("Playback Position"), 0.0f);
+
+        if (!Test.TestTrue(TEXT("Operator created"), Harness.CreateOperator()))
+        {
+            return Iterations;
+        }
+
+        const int32 NumBlocks = FMath::RoundToInt(NumLoops * LoopSeconds / BlockSeconds);
+        for (int32 Block = 0; Block < NumBlocks; ++Block)
+        {
+            *Playback = static_cast<float>(FMath::Fmod((Block + 1) * BlockSeconds + PhaseSeconds, LoopSeconds));
+            Harness.Execute();
+        }
+
+        Listener.Drain();
+
+        for (const FMetaSoundNotifyEvent& Event : Listener.Events)
+        {
+            Iterations.Add(Event.IntValue);
+        }
+
+        return Iterations;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaSoundNotifyRawCuePointLoopHeadTest, "MetaSoundNotify.RawCuePoint.LoopHead", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundNotifyRawCuePointLoopHeadTest::RunTest(const FString& Parameters)
+{
+    // Right at the loop start: crossed by the first block, then by every block that wraps.
+    const TArray<int32> Iterations = MetaSoundNotifyRawCuePointNodeTests::RunLoops(*this, 0.0f);
+    TestEqual(TEXT("Loop iterations of the notifies"), Iterations, TArray<int32>({ 0, 1, 2, 3 }));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaSoundNotifyRawCuePointLoopTailTest, "MetaSoundNotify.RawCuePoint.LoopTail", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundNotifyRawCuePointLoopTailTest::RunTest(const FString& Parameters)
+{
+    // After the last position seen before every wrap: only the wrapping block crosses it.
+    const TArray<int32> Iterations = MetaSoundNotifyRawCuePointNodeTests::RunLoops(*this, 0.995f);
+    TestEqual(TEXT("Loop iterations of the notifies"), Iterations, TArray<int32>({ 0, 1, 2 }));
+
+    return true;
+}
+
+#endif
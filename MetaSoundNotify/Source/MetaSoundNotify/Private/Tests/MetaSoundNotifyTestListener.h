@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaSoundNotifyDispatcher.h"
+#include "MetaSoundNotifyMockListener.h"
+#include "MetaSoundNotifySubsystem.h"
+
+/**
+ * @name FMetaSoundNotifyTestListener
+ * @brief Listener registered in the subsystem for the length of a test. Pass its handle to the nodes under test, every
+ * notify delivered to it is kept in Events.
+ */
+class FMetaSoundNotifyTestListener
+{
+public:
+    FMetaSoundNotifyTestListener()
+    {
+        Subsystem = UMetaSoundNotifySubsystem::Get();
+        if (!Subsystem)
+        {
+            return;
+        }
+
+        // Nothing left over from earlier sends.
+        FMetaSoundNotifyDispatcher::Get().Drain();
+
+        Listener = NewObject<UMetaSoundNotifyMockListener>();
+        Listener->AddToRoot();
+
+        Handle = Subsystem->RegisterListener(Listener);
+        Subsystem->AddNativeListener(Listener, INDEX_NONE, FMetaSoundNotifyNativeDelegate::CreateLambda([this](const FMetaSoundNotifyEvent& Event)
+        {
+            Events.Add(Event);
+        }));
+    }
+
+    ~FMetaSoundNotifyTestListener()
+    {
+        if (Listener)
+        {
+            Subsystem->RemoveNativeListeners(Listener);
+            Subsystem->UnregisterListener(Handle);
+            Listener->RemoveFromRoot();
+        }
+    }
+
+    bool IsValid() const
+    {
+        return Listener != nullptr;
+    }
+
+    int32 GetHandle() const
+    {
+        return Handle;
+    }
+
+    /** Delivers everything the nodes sent so far. */
+    void Drain()
+    {
+        FMetaSoundNotifyDispatcher::Get().Drain();
+    }
+
+    TArray<FMetaSoundNotifyEvent> Events;
+
+private:
+    UMetaSoundNotifySubsystem* Subsystem = nullptr;
+    UMetaSoundNotifyMockListener* Listener = nullptr;
+    int32 Handle = 0;
+};
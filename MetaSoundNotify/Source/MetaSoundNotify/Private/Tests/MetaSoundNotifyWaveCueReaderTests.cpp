@@ -0,0 +1,160 @@
+#include "Misc/AutomationTest.h"
+#include "MetaSoundNotifyWaveCueReader.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MetaSoundNotifyWaveCueReaderTests
+{
+    void AppendUInt32(TArray<uint8>& OutData, uint32 InValue)
+    {
+        OutData.Add(InValue & 0xFF);
+        OutData.Add((InValue >> 8) & 0xFF);
+        OutData.Add((InValue >> 16) & 0xFF);
+        OutData.Add((InValue >> 24) & 0xFF);
+    }
+
+    void AppendID(TArray<uint8>& OutData, const char* InID)
+    {
+        OutData.Append(reinterpret_cast<const uint8*>(InID), 4);
+    }
+
+    // RIFF header followed by a 48 kHz "fmt " chunk. The RIFF size isn't checked by the reader.
+    TArray<uint8> MakeWave()
+    {
+        TArray<uint8> Data;
+        AppendID(Data, "RIFF");
+        AppendUInt32(Data, 0);
+        AppendID(Data, "WAVE");
+
+        AppendID(Data, "fmt ");
+        AppendUInt32(Data, 16);
+        AppendUInt32(Data, 0x00010001); // PCM, mono
+        AppendUInt32(Data, 48000);
+        AppendUInt32(Data, 96000);
+        AppendUInt32(Data, 0x00100002); // Block align 2, 16 bits
+        return Data;
+    }
+
+    void AppendCue(TArray<uint8>& OutData, int32 InID, int32 InSampleOffset)
+    {
+        AppendUInt32(OutData, InID);
+        AppendUInt32(OutData, InSampleOffset);
+        AppendID(OutData, "data");
+        AppendUInt32(OutData, 0);
+        AppendUInt32(OutData, 0);
+        AppendUInt32(OutData, InSampleOffset);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaSoundNotifyWaveCueReaderLabelsTest, "MetaSoundNotify.WaveCueReader.Labels", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundNotifyWaveCueReaderLabelsTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaSoundNotifyWaveCueReaderTests;
+
+    TArray<uint8> Data = MakeWave();
+
+    AppendID(Data, "cue ");
+    AppendUInt32(Data, 4 + 2 * 24);
+    AppendUInt32(Data, 2);
+    AppendCue(Data, 1, 100);
+    AppendCue(Data, 2, 48000);
+
+    // "labl" of 9 bytes, padded to 10.
+    AppendID(Data, "LIST");
+    AppendUInt32(Data, 4 + 8 + 10);
+    AppendID(Data, "adtl");
+    AppendID(Data, "labl");
+    AppendUInt32(Data, 9);
+    AppendUInt32(Data, 2);
+    Data.Append(reinterpret_cast<const uint8*>("Drop\0\0"), 6);
+
+    FMetaSoundNotifyWaveCues Cues;
+    FString Error;
+
+    TestTrue(TEXT("Read succeeds"), FMetaSoundNotifyWaveCueReader::Read(Data, Cues, Error));
+    TestEqual(TEXT("Sample rate"), Cues.SampleRate, 48000);
+
+    if (TestEqual(TEXT("Number of cues"), Cues.Cues.Num(), 2))
+    {
+        TestEqual(TEXT("First cue offset"), Cues.Cues[0].SampleOffset, 100);
+        TestTrue(TEXT("First cue has no label"), Cues.Cues[0].Label.IsEmpty());
+        TestEqual(TEXT("Second cue offset"), Cues.Cues[1].SampleOffset, 48000);
+        TestEqual(TEXT("Second cue label"), Cues.Cues[1].Label, FString(TEXT("Drop")));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaSoundNotifyWaveCueReaderTruncatedTest, "MetaSoundNotify.WaveCueReader.Truncated", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundNotifyWaveCueReaderTruncatedTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaSoundNotifyWaveCueReaderTests;
+
+    // The cue chunk announces two cues but the file ends in the middle of the first one.
+    TArray<uint8> Data = MakeWave();
+    AppendID(Data, "cue ");
+    AppendUInt32(Data, 4 + 2 * 24);
+    AppendUInt32(Data, 2);
+    AppendUInt32(Data, 1);
+    AppendUInt32(Data, 100);
+
+    FMetaSoundNotifyWaveCues Cues;
+    FString Error;
+
+    TestTrue(TEXT("Read keeps what comes before the truncated chunk"), FMetaSoundNotifyWaveCueReader::Read(Data, Cues, Error));
+    TestEqual(TEXT("Sample rate"), Cues.SampleRate, 48000);
+    TestEqual(TEXT("No cue read from the truncated chunk"), Cues.Cues.Num(), 0);
+
+    // Cut in the middle of a chunk header, and in the middle of the RIFF header.
+    Data.SetNum(12 + 8 + 16 + 6);
+    TestTrue(TEXT("Read stops at a truncated chunk header"), FMetaSoundNotifyWaveCueReader::Read(Data, Cues, Error));
+
+    Data.SetNum(10);
+    TestFalse(TEXT("Read rejects a truncated RIFF header"), FMetaSoundNotifyWaveCueReader::Read(Data, Cues, Error));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaSoundNotifyWaveCueReaderOversizedChunkTest, "MetaSoundNotify.WaveCueReader.OversizedChunk", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundNotifyWaveCueReaderOversizedChunkTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaSoundNotifyWaveCueReaderTests;
+
+    // Sizes that wrapped the bounds check around: 0xFFFFFFF8 made the next offset not move at all.
+    const uint32 OversizedSizes[] = { 0xFFFFFFF8, 0xFFFFFFFF, 0xFFFFFFF0 };
+
+    for (const uint32 OversizedSize : OversizedSizes)
+    {
+        TArray<uint8> Data = MakeWave();
+        AppendID(Data, "cue ");
+        AppendUInt32(Data, OversizedSize);
+        AppendUInt32(Data, 1000);
+        AppendCue(Data, 1, 100);
+
+        FMetaSoundNotifyWaveCues Cues;
+        FString Error;
+
+        TestTrue(TEXT("Read returns on an oversized cue chunk"), FMetaSoundNotifyWaveCueReader::Read(Data, Cues, Error));
+        TestEqual(TEXT("No cue read from an oversized cue chunk"), Cues.Cues.Num(), 0);
+
+        // Same thing inside the label list.
+        Data = MakeWave();
+        AppendID(Data, "LIST");
+        AppendUInt32(Data, 4 + 8 + 8);
+        AppendID(Data, "adtl");
+        AppendID(Data, "labl");
+        AppendUInt32(Data, OversizedSize);
+        AppendUInt32(Data, 1);
+        Data.Append(reinterpret_cast<const uint8*>("Cue\0"), 4);
+
+        TestTrue(TEXT("Read returns on an oversized label"), FMetaSoundNotifyWaveCueReader::Read(Data, Cues, Error));
+        TestEqual(TEXT("Sample rate"), Cues.SampleRate, 48000);
+    }
+
+    return true;
+}
+
+#endif
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogMetaSoundNotify, Log, All);
+
 class FMetaSoundNotifyModule : public IModuleInterface
 {
 public:
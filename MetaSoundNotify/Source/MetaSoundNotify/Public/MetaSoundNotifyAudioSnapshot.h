@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/RefCounting.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "MetaSoundNotifyAudioSnapshot.generated.h"
+
+/**
+ * @name FMetaSoundNotifyAudioBlock
+ * @brief Window of samples published by a Notify Audio Snapshot node.
+ * Blocks are allocated once by the node and recycled as soon as nobody references them anymore, so publishing never
+ * allocates on the render thread and listeners read the samples in place.
+ */
+class METASOUNDNOTIFY_API FMetaSoundNotifyAudioBlock : public FRefCountBase
+{
+public:
+    explicit FMetaSoundNotifyAudioBlock(int32 InCapacity)
+    {
+        Samples.SetNumZeroed(InCapacity);
+    }
+
+    TArrayView<const float> GetSamples() const
+    {
+        return MakeArrayView(Samples.GetData(), NumSamples);
+    }
+
+    float GetSampleRate() const
+    {
+        return SampleRate;
+    }
+
+    /** Writer side, only the node owning the block calls these, while nobody else references it. */
+    float* GetData()
+    {
+        return Samples.GetData();
+    }
+
+    int32 GetCapacity() const
+    {
+        return Samples.Num();
+    }
+
+    void Publish(int32 InNumSamples, float InSampleRate)
+    {
+        NumSamples = FMath::Min(InNumSamples, Samples.Num());
+        SampleRate = InSampleRate;
+    }
+
+private:
+    TArray<float> Samples;
+    int32 NumSamples = 0;
+    float SampleRate = 0.0f;
+};
+
+/**
+ * @brief Window of audio received from a Notify Audio Snapshot node. Copying it only copies a reference to the samples.
+ */
+USTRUCT(BlueprintType)
+struct METASOUNDNOTIFY_API FMetaSoundNotifyAudioSnapshot
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Number of samples in the window."))
+    int32 NumSamples = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Sample rate of the window, after decimation."))
+    float SampleRate = 0.0f;
+
+    /** Samples of the window, valid as long as the snapshot is. */
+    TArrayView<const float> GetSamples() const
+    {
+        return Block.IsValid() ? Block->GetSamples() : TArrayView<const float>();
+    }
+
+    void Reset()
+    {
+        Block.SafeRelease();
+        NumSamples = 0;
+        SampleRate = 0.0f;
+    }
+
+    TRefCountPtr<FMetaSoundNotifyAudioBlock> Block;
+};
+
+/**
+ * @brief Blueprint access to audio snapshots.
+ */
+UCLASS()
+class METASOUNDNOTIFY_API UMetaSoundNotifyAudioSnapshotLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "Copies the samples of the snapshot into an array."))
+    static void GetSnapshotSamples(const FMetaSoundNotifyAudioSnapshot& Snapshot, TArray<float>& Samples);
+
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "Highest absolute sample of the snapshot, without copying it."))
+    static float GetSnapshotPeak(const FMetaSoundNotifyAudioSnapshot& Snapshot);
+
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "RMS level of the snapshot, without copying it."))
+    static float GetSnapshotRMS(const FMetaSoundNotifyAudioSnapshot& Snapshot);
+};
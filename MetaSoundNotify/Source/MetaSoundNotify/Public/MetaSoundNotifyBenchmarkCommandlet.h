@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MetaSoundNotifyBenchmarkCommandlet.generated.h"
+
+/**
+ * @brief Headless benchmarks of the notify pipeline, runs faster than real time.
+ * Usage: -run=MetaSoundNotifyBenchmark -Mode=<Mode> [options]
+ * Delivery [-Rate=10000] [-Seconds=10] [-FrameRate=60] [-ListenerClass=<Blueprint class path>]
+ *   Cost of delivering a notify on the game thread to a native listener bound through the subsystem, and to the
+ *   Blueprint listener class given by -ListenerClass through the interface.
+ * Latency [-Instances=64] [-SendEvery=4] [-Seconds=10] [-FrameRate=60] [-SampleRate=48000] [-BlockSize=256]
+ *   Time from the block a Notify Float node is triggered in, to its listener being called. Runs Notify Float operators
+ *   on a render thread paced in real time and drains on the game thread, without any audio device.
+ * Scale [-Operators=10000] [-Blocks=200] [-SampleRate=48000] [-BlockSize=256]
+ *   Execute() cost of thousands of Notify Float and Notify Raw Cue Point operators, in ns per block per operator, for
+ *   idle blocks and for blocks where every operator sends a notify.
+ */
+UCLASS()
+class METASOUNDNOTIFY_API UMetaSoundNotifyBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMetaSoundNotifyBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    int32 RunDelivery(const FString& Params);
+    int32 RunLatency(const FString& Params);
+    int32 RunScale(const FString& Params);
+};
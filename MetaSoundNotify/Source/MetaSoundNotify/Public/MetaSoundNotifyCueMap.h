@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MetaSoundNotifyCueMap.generated.h"
+
+struct FMetaSoundNotifyWaveCues;
+
+/**
+ * @brief Precomputed cue points of a wave file.
+ * Cue offsets are stored sorted, and labels are interned: every cue only stores the index of its label, so looking up a
+ * cue is a binary search that never touches a string. Build it from the cue and label chunks of a WAV file, either with
+ * ImportWaveFile or offline with the MetaSoundNotifyCueMap commandlet.
+ */
+UCLASS(BlueprintType)
+class METASOUNDNOTIFY_API UMetaSoundNotifyCueMap : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Sample rate of the wave the cue points were read from. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Notifies)
+    int32 SampleRate = 0;
+
+    /** Position of every cue point in samples, sorted. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Notifies)
+    TArray<int32> SampleOffsets;
+
+    /** ID of every cue point in the wave file, in the same order as SampleOffsets. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Notifies)
+    TArray<int32> CuePointIDs;
+
+    /** Index in Labels of the label of every cue point, or INDEX_NONE if it has no label. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Notifies)
+    TArray<int32> LabelIndices;
+
+    /** Every different label, only stored once. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Notifies)
+    TArray<FString> Labels;
+
+    /** Replaces the content of the map with the cue points read from a wave file. */
+    void Build(const FMetaSoundNotifyWaveCues& InWaveCues);
+
+    UFUNCTION(BlueprintCallable, Category = Notifies, meta = (ToolTip = "Reads the cue points and labels of a WAV file on disk into this map. Returns false if the file can't be read or parsed."))
+    bool ImportWaveFile(const FString& Filename);
+
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "Number of cue points in the map."))
+    int32 GetNumCues() const;
+
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "Index of the first cue point at or after the sample, or the number of cues if there is none."))
+    int32 FindNextCue(int64 SampleOffset) const;
+
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "Cue points in [StartSample, EndSample) are the ones from FirstCue to LastCue excluded."))
+    void FindCuesInRange(int64 StartSample, int64 EndSample, int32& FirstCue, int32& LastCue) const;
+
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "Label of a cue point, empty if it has none."))
+    FString GetCueLabel(int32 CueIndex) const;
+
+    UFUNCTION(BlueprintCallable, Category = Notifies, meta = (ToolTip = "Cue point positions in seconds and their labels, ready to be sent to a Notify Cue Point Table node."))
+    void GetCueTable(TArray<float>& OutPositions, TArray<FString>& OutLabels) const;
+};
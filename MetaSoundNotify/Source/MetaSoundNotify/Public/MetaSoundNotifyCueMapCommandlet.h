@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MetaSoundNotifyCueMapCommandlet.generated.h"
+
+/**
+ * @brief Preprocesses whole music libraries into cue map assets, offline.
+ * Usage: -run=MetaSoundNotifyCueMap -Source=<wav file or folder> [-Destination=/Game/CueMaps]
+ * Every WAV file found (recursively) gets a <Name>_CueMap asset in the destination folder.
+ */
+UCLASS()
+class METASOUNDNOTIFY_API UMetaSoundNotifyCueMapCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMetaSoundNotifyCueMapCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MetaSoundNotifyOfflineRenderCommandlet.generated.h"
+
+/**
+ * @brief Renders a MetaSound as fast as the CPU allows and writes every notify it sends into a golden file.
+ * Usage: -run=MetaSoundNotifyOfflineRender -MetaSound=<MetaSound Source path> -Output=<file> [-Golden=<file>]
+ *        [-Seconds=60] [-SampleRate=48000] [-BlockSize=256] [-Groups=<Group>,<Group>] [-HandleInput=<int32 input name>]
+ * Nothing is played: the graph runs block by block without any audio device. The notifies of its nodes are recorded by
+ * a mock listener, which joins the groups given by -Groups and whose handle is passed into the graph input named by
+ * -HandleInput. With -Golden, the output is compared with an existing file and the commandlet fails on any difference.
+ */
+UCLASS()
+class METASOUNDNOTIFY_API UMetaSoundNotifyOfflineRenderCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMetaSoundNotifyOfflineRenderCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
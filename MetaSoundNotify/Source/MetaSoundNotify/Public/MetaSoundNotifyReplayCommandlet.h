@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MetaSoundNotifyReplayCommandlet.generated.h"
+
+/**
+ * @brief Plays a notify log recorded with au.MetaSoundNotify.Record back into a listener, without any audio running.
+ * Usage: -run=MetaSoundNotifyReplay -Log=<file> [-Speed=0] [-FrameRate=60] [-ListenerClass=<Blueprint class path>]
+ * Every notify goes to a native listener that only counts them, or to an instance of -ListenerClass through the
+ * interface. -Speed=1 sends the notifies at the rate they were recorded, drained once per frame; -Speed=0 sends them
+ * as fast as the listener takes them. Reports the notifies delivered per second and the game thread time per notify.
+ */
+UCLASS()
+class METASOUNDNOTIFY_API UMetaSoundNotifyReplayCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMetaSoundNotifyReplayCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
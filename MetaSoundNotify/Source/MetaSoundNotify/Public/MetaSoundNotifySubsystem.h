@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MetaSoundNotifyTypes.h"
+#include "MetaSoundNotifySubsystem.generated.h"
+
+/** Native callback of a listener, receives the full payload of the notify. */
+DECLARE_DELEGATE_OneParam(FMetaSoundNotifyNativeDelegate, const FMetaSoundNotifyEvent& /*Event*/);
+
+/**
+ * @brief Registry of MetaSound Notify listeners.
+ * Registering a listener returns a compact handle that can be passed into the "Listener Handle" input of any notify node
+ * instead of a string address. Handles carry a generation counter, so a handle kept after unregistering is simply ignored.
+ * Listeners destroyed without unregistering get their handle released after the next garbage collection.
+ * Listeners can also join named groups, a node whose "To Notify" address is "group:Name" notifies every member.
+ * C++ listeners can bind native delegates instead of implementing the interface, they are called directly without going
+ * through the Blueprint VM.
+ */
+UCLASS()
+class METASOUNDNOTIFY_API UMetaSoundNotifySubsystem : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMetaSoundNotifySubsystem* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    UFUNCTION(BlueprintCallable, Category = Notifies, meta = (ToolTip = "Registers a listener and returns its handle. Registering the same listener twice returns the same handle."))
+    int32 RegisterListener(UObject* Listener);
+
+    UFUNCTION(BlueprintCallable, Category = Notifies, meta = (ToolTip = "Unregisters the listener owning this handle. The handle becomes invalid."))
+    void UnregisterListener(int32 Handle);
+
+    UFUNCTION(BlueprintPure, Category = Notifies, meta = (ToolTip = "Returns the listener registered with this handle, or null if the handle is not valid anymore."))
+    UObject* GetListener(int32 Handle) const;
+
+    UFUNCTION(BlueprintCallable, Category = Notifies, meta = (ToolTip = "Adds a listener to a group. Nodes notifying \"group:<Group>\" notify every member of the group."))
+    void JoinGroup(FName Group, UObject* Listener);
+
+    UFUNCTION(BlueprintCallable, Category = Notifies, meta = (ToolTip = "Removes a listener from a group."))
+    void LeaveGroup(FName Group, UObject* Listener);
+
+    /** Members of a group, null if nobody ever joined it. Members may have been destroyed since they joined. */
+    const TArray<TWeakObjectPtr<UObject>>* FindGroupMembers(FName Group) const;
+
+    /**
+     * Binds a native delegate called whenever Listener is notified with this NotifyID, or with any NotifyID if it is
+     * INDEX_NONE. A notify matching a native binding only calls the delegates, the interface events of the listener are
+     * not called. Notifies no binding matches still go through the interface.
+     * Bindings of a listener destroyed without removing them are dropped at the next garbage collection.
+     */
+    FDelegateHandle AddNativeListener(UObject* Listener, int32 NotifyID, FMetaSoundNotifyNativeDelegate Delegate);
+
+    /** Removes one binding of a listener, using the handle returned by AddNativeListener. */
+    void RemoveNativeListener(UObject* Listener, FDelegateHandle Handle);
+
+    /** Removes every binding of a listener. */
+    void RemoveNativeListeners(UObject* Listener);
+
+    /** Whether a listener has a native binding for this NotifyID, or for any NotifyID. */
+    bool HasNativeListener(const UObject* Listener, int32 NotifyID) const;
+
+    /** Calls the delegates of a listener matching the NotifyID of the event. Game thread only. */
+    void ExecuteNativeListener(const UObject* Listener, const FMetaSoundNotifyEvent& Event);
+
+private:
+    struct FListenerSlot
+    {
+        TWeakObjectPtr<UObject> Listener;
+        uint16 Generation = 0;
+        bool bInUse = false;
+    };
+
+    // Handle layout: low 16 bits are the slot index plus one (so 0 is never valid), the next 15 bits the slot generation.
+    static constexpr int32 IndexBits = 16;
+    static constexpr int32 IndexMask = (1 << IndexBits) - 1;
+    static constexpr int32 GenerationMask = 0x7FFF;
+    static constexpr int32 MaxSlots = IndexMask;
+
+    struct FNativeBinding
+    {
+        int32 NotifyID = INDEX_NONE;
+        FMetaSoundNotifyNativeDelegate Delegate;
+    };
+
+    // Change of the native bindings requested by a delegate while they were being called. An unbound delegate removes
+    // the binding with the handle, or all of them if the handle isn't valid either.
+    struct FPendingNativeChange
+    {
+        FObjectKey Listener;
+        FDelegateHandle Handle;
+        FNativeBinding Binding;
+    };
+
+    void ApplyNativeChange(FPendingNativeChange&& Change);
+
+    void ReleaseSlot(int32 SlotIndex);
+    // Frees the slots, group memberships and native bindings of listeners destroyed without unregistering, after every
+    // garbage collection.
+    void ReleaseDestroyedListeners();
+
+    static int32 MakeHandle(int32 SlotIndex, uint16 Generation);
+    const FListenerSlot* FindSlot(int32 Handle) const;
+
+    TArray<FListenerSlot> Slots;
+    TArray<int32> FreeSlots;
+    TMap<TWeakObjectPtr<UObject>, int32> ListenerHandles;
+    // Members are kept contiguous so delivering to a group is one pass over an array.
+    TMap<FName, TArray<TWeakObjectPtr<UObject>>> Groups;
+    TMap<FObjectKey, TArray<FNativeBinding>> NativeListeners;
+    TArray<FPendingNativeChange> PendingNativeChanges;
+    bool bExecutingNativeListener = false;
+    FDelegateHandle PostGarbageCollectHandle;
+};
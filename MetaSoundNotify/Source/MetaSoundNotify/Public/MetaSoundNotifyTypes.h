@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetaSoundNotifyAudioSnapshot.h"
+#include "MetaSoundNotifyTypes.generated.h"
+
+/**
+ * @brief Kind of node a notify comes from.
+ */
+UENUM(BlueprintType)
+enum class EMetaSoundNotifyType : uint8
+{
+    Notify,
+    String,
+    Int,
+    Float,
+    Bool,
+    CuePoint,
+    RawCuePoint,
+    Beat,
+    Threshold,
+    Onset,
+    Time,
+    AudioSnapshot
+};
+
+/**
+ * @brief Full payload of a notify, whatever node sent it.
+ * Only the fields used by the sending node are filled, the rest keep their default value.
+ */
+USTRUCT(BlueprintType)
+struct METASOUNDNOTIFY_API FMetaSoundNotifyEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Kind of node that sent the notify."))
+    EMetaSoundNotifyType Type = EMetaSoundNotifyType::Notify;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Notify ID of the node."))
+    int32 NotifyID = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Int value, cue point ID for cue point notifies, or loop iteration for raw cue point notifies."))
+    int32 IntValue = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Float value, time in seconds for time notifies, envelope level for threshold notifies, or onset strength for onset notifies."))
+    float FloatValue = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Bool value, whether the beat is the first of its bar for beat notifies, or whether the envelope rose above the threshold for threshold notifies."))
+    bool bBoolValue = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Message, or cue point label for cue point notifies."))
+    FString Message;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Bar index for beat notifies, counted from 0."))
+    int32 Bar = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Beat inside the bar for beat notifies, counted from 0."))
+    int32 Beat = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Window of audio for audio snapshot notifies."))
+    FMetaSoundNotifyAudioSnapshot Snapshot;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Sample at which the notify was sent, counted from the start of the MetaSound."))
+    int64 SampleIndex = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = Notifies, meta = (ToolTip = "Audio clock time in seconds at which the notify was sent, counted from the start of the MetaSound."))
+    double AudioTime = 0.0;
+};